@@ -2,6 +2,12 @@
 #define MULTIDIMGRID_H
 
 #include "src/GridFunction.hpp"
+#include "src/InterpolationCursor.hpp"
+#include "src/LazyGridFunction.hpp"
+#include "src/MultiFieldGridFunction.hpp"
+#include "src/SparseGridFunction.hpp"
+#include "src/SplineGridFunction.hpp"
+#include "src/StaticGridFunction.hpp"
 
 #include "src/LinearCoordinateAxis.hpp"
 #include "src/LinearLogarithmicCoordinateAxis.hpp"
@@ -0,0 +1,49 @@
+#ifndef MULTIDIMGRID_BENCHMARK_UTILITIES_H
+#define MULTIDIMGRID_BENCHMARK_UTILITIES_H
+
+#include "../MultiDimGrid.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * Utilities shared by the MultiDimGrid benchmarks:
+ * 
+ * The function discretized by all benchmarks and the timing of repeated measurements.
+ */
+
+template <std::size_t Dim>
+double test_function (const MultiDimGrid::Coordinates<Dim>& x)	// smooth function with a different dependence on each coordinate
+{
+	double value = 0.0;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		value += std::sin((i_axis + 1) * x[i_axis]);
+	}
+	
+	return value;
+}
+
+template <class Operation>
+double fastest_time (const Operation& operation, const std::size_t repetitionNumber)	// fastest time of 'repetitionNumber' repetitions of 'operation' in nanoseconds
+{
+	double fastestTime = INFINITY;
+	
+	for ( std::size_t i_repetition = 0; i_repetition < repetitionNumber; ++i_repetition )
+	{
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		
+		operation();
+		
+		const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		
+		fastestTime = std::min(fastestTime, std::chrono::duration<double, std::nano>(end - start).count());
+	}
+	
+	return fastestTime;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,276 @@
+#include "BenchmarkUtilities.hpp"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * MultiDimGrid benchmark:
+ * 
+ * Measurement of the performance of the basic operations of MultiDimGrid::GridFunction on grids with 1 to 6 dimensions,
+ * spanned up by each type of coordinate axis. All grids have about 'targetPointNumber' grid points:
+ *  - Linear:            all axes are linearly spaced
+ *  - Logarithmic:       all axes are logarithmically spaced
+ *  - LinearLogarithmic: all axes are linearly spaced below and logarithmically spaced above a threshold value
+ *  - SinglePoint:       the last axis consists of a single point, the others are linearly spaced
+ * 
+ * The following operations are measured:
+ *  - construction:          construction of the grid function from a function, per grid point
+ *  - interpolate:           interpolation at random coordinates one at a time, per interpolation
+ *  - interpolate_static:    the same interpolations by a MultiDimGrid::StaticGridFunction with the same axes, per interpolation
+ *  - interpolate_many:      interpolation at the same coordinates as a whole, per interpolation
+ *  - value:                 access of the function values at all grid points in random order by grid point, per access
+ *  - value_at_index:        access of the same function values by index, per access
+ *  - coordinates_at_index:  extraction of the coordinates at the same grid points by index, per extraction
+ *  - integrate:             integration over the whole grid, per grid point
+ * 
+ * The operations that can be distributed among OpenMP threads (construction, interpolate_many and integrate) are
+ * measured for 1, 2, 4, ... threads up to the maximum number of threads, the others only for a single thread. Each
+ * measurement is repeated 'repetitionNumber' times and the fastest repetition is reported.
+ * 
+ * The results are written to the standard output as comma-separated values, one line per operation, dimension, axis type
+ * and number of threads, containing the number of grid points, the time per operation in nanoseconds and the number of
+ * operations per second.
+ */
+
+const double targetPointNumber = 262144.0;	// approximate number of grid points of every grid
+const std::size_t queryNumber = 262144;		// number of coordinates at which the grid functions are interpolated
+const std::size_t repetitionNumber = 5;		// number of timed repetitions, of which the fastest is reported
+
+volatile double sink;	// destination of the results of the measured operations, which keeps them from being optimized away
+
+template <std::size_t AxisNumber, class Axis, class LastAxis, class... Axes>
+struct StaticGridFunctionType : StaticGridFunctionType<AxisNumber - 1, Axis, LastAxis, Axis, Axes...>	// provides the type of a StaticGridFunction with 'AxisNumber' axes of type 'Axis' followed by one of type 'LastAxis'
+{};
+
+template <class Axis, class LastAxis, class... Axes>
+struct StaticGridFunctionType<0, Axis, LastAxis, Axes...>
+{
+	typedef MultiDimGrid::StaticGridFunction<Axes..., LastAxis> Type;
+};
+
+void report (const std::string& operationName, const std::size_t dim, const std::string& axisTypeName, const int threadNumber, const double pointNumber, const double time, const double operationNumber)
+{
+	std::cout << operationName << "," << dim << "," << axisTypeName << "," << threadNumber << "," << pointNumber << "," << time / operationNumber << "," << 1.0e9 * operationNumber / time << std::endl;
+}
+
+std::vector<int> thread_numbers ()	// 1, 2, 4, ... threads up to and including the maximum number of threads
+{
+	const int maxThreadNumber = omp_get_max_threads();
+	
+	std::vector<int> threadNumbers;
+	
+	for ( int threadNumber = 1; threadNumber < maxThreadNumber; threadNumber *= 2 )
+	{
+		threadNumbers.push_back(threadNumber);
+	}
+	
+	threadNumbers.push_back(maxThreadNumber);
+	
+	return threadNumbers;
+}
+
+std::vector<std::unique_ptr<MultiDimGrid::CoordinateAxis>> create_axes (const std::size_t dim, const std::string& axisTypeName)	// coordinate axes of a grid with about 'targetPointNumber' grid points
+{
+	const std::size_t spacedAxisNumber = (axisTypeName == "SinglePoint") ? (dim - 1) : dim;	// number of axes with more than one point
+	const std::size_t intervalNumber = (spacedAxisNumber == 0) ? 0 : std::max<std::size_t>(2, std::round(std::pow(targetPointNumber, 1.0 / spacedAxisNumber)) - 1);
+	
+	std::vector<std::unique_ptr<MultiDimGrid::CoordinateAxis>> axes;
+	
+	for ( std::size_t i_axis = 0; i_axis < dim; ++i_axis )
+	{
+		if ( axisTypeName == "Logarithmic" )
+		{
+			axes.emplace_back(new MultiDimGrid::LogarithmicCoordinateAxis(0.001, 1.0, intervalNumber));
+		}
+		else if ( axisTypeName == "LinearLogarithmic" )
+		{
+			axes.emplace_back(new MultiDimGrid::LinearLogarithmicCoordinateAxis(0.0, 0.1, 1.0, intervalNumber / 2, intervalNumber - intervalNumber / 2));
+		}
+		else if ( axisTypeName == "SinglePoint" && i_axis == dim - 1 )
+		{
+			axes.emplace_back(new MultiDimGrid::SinglePointCoordinateAxis(0.5));
+		}
+		else
+		{
+			axes.emplace_back(new MultiDimGrid::LinearCoordinateAxis(0.0, 1.0, intervalNumber));
+		}
+	}
+	
+	return axes;
+}
+
+template <std::size_t Dim, class Axis, class LastAxis>
+void benchmark_grid (const std::string& axisTypeName)	// 'Axis' and 'LastAxis' have to be the types of the axes created for 'axisTypeName'
+{
+	const std::vector<std::unique_ptr<MultiDimGrid::CoordinateAxis>> axes = create_axes(Dim, axisTypeName);
+	
+	MultiDimGrid::CoordinateAxisPointers<Dim> axisPointers;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		axisPointers[i_axis] = axes[i_axis].get();
+	}
+	
+	const MultiDimGrid::GridFunction<Dim> gridFunc(axisPointers, test_function<Dim>, MultiDimGrid::ParallelSchedule::Static);
+	
+	const typename StaticGridFunctionType<Dim - 1, Axis, LastAxis>::Type staticGridFunc(gridFunc);
+	
+	const double pointNumber = gridFunc.point_number();
+	
+	std::mt19937_64 generator(Dim);
+	
+	std::vector<MultiDimGrid::Coordinates<Dim>> coords(queryNumber);	// random coordinates within the grid
+	std::vector<double> values(queryNumber);
+	
+	for ( MultiDimGrid::Coordinates<Dim>& x : coords )
+	{
+		for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+		{
+			std::uniform_real_distribution<double> distribution(axes[i_axis]->lower_coordinate_limit(), axes[i_axis]->upper_coordinate_limit());
+			
+			x[i_axis] = distribution(generator);
+		}
+	}
+	
+	std::vector<std::size_t> indices(pointNumber);	// indices of all grid points in random order
+	std::vector<MultiDimGrid::GridPoint<Dim>> gridPoints(pointNumber);
+	
+	for ( std::size_t index = 0; index < indices.size(); ++index )
+	{
+		indices[index] = index;
+	}
+	
+	std::shuffle(indices.begin(), indices.end(), generator);
+	
+	for ( std::size_t i_point = 0; i_point < indices.size(); ++i_point )	// grid points corresponding to the shuffled indices, with the innermost axis point varying fastest
+	{
+		std::size_t remainingIndex = indices[i_point];
+		
+		for ( std::size_t i_axis = Dim; i_axis-- > 0; )
+		{
+			gridPoints[i_point][i_axis] = remainingIndex % axes[i_axis]->point_number();
+			
+			remainingIndex /= axes[i_axis]->point_number();
+		}
+	}
+	
+	const std::vector<int> threadNumbers = thread_numbers();	// determined before the number of threads is changed
+	
+	omp_set_num_threads(1);
+	
+	report("interpolate", Dim, axisTypeName, 1, pointNumber, fastest_time([&gridFunc, &coords] ()
+	{
+		double sum = 0.0;
+		
+		for ( const MultiDimGrid::Coordinates<Dim>& x : coords )
+		{
+			sum += gridFunc.interpolate_unchecked(x);
+		}
+		
+		sink = sum;
+	}, repetitionNumber), queryNumber);
+	
+	report("interpolate_static", Dim, axisTypeName, 1, pointNumber, fastest_time([&staticGridFunc, &coords] ()
+	{
+		double sum = 0.0;
+		
+		for ( const MultiDimGrid::Coordinates<Dim>& x : coords )
+		{
+			sum += staticGridFunc.interpolate_unchecked(x);
+		}
+		
+		sink = sum;
+	}, repetitionNumber), queryNumber);
+	
+	report("value", Dim, axisTypeName, 1, pointNumber, fastest_time([&gridFunc, &gridPoints] ()
+	{
+		double sum = 0.0;
+		
+		for ( const MultiDimGrid::GridPoint<Dim>& gridPoint : gridPoints )
+		{
+			sum += gridFunc.value_unchecked(gridPoint);
+		}
+		
+		sink = sum;
+	}, repetitionNumber), pointNumber);
+	
+	report("value_at_index", Dim, axisTypeName, 1, pointNumber, fastest_time([&gridFunc, &indices] ()
+	{
+		double sum = 0.0;
+		
+		for ( const std::size_t index : indices )
+		{
+			sum += gridFunc.value_at_index_unchecked(index);
+		}
+		
+		sink = sum;
+	}, repetitionNumber), pointNumber);
+	
+	report("coordinates_at_index", Dim, axisTypeName, 1, pointNumber, fastest_time([&gridFunc, &indices] ()
+	{
+		double sum = 0.0;
+		
+		for ( const std::size_t index : indices )
+		{
+			sum += gridFunc.coordinates_at_index_unchecked(index)[Dim - 1];
+		}
+		
+		sink = sum;
+	}, repetitionNumber), pointNumber);
+	
+	for ( const int threadNumber : threadNumbers )	// operations distributed among OpenMP threads
+	{
+		omp_set_num_threads(threadNumber);
+		
+		report("construction", Dim, axisTypeName, threadNumber, pointNumber, fastest_time([&axisPointers] ()
+		{
+			const MultiDimGrid::GridFunction<Dim> constructedGridFunc(axisPointers, test_function<Dim>, MultiDimGrid::ParallelSchedule::Static);
+			
+			sink = constructedGridFunc.value_at_index(0);
+		}, repetitionNumber), pointNumber);
+		
+		report("interpolate_many", Dim, axisTypeName, threadNumber, pointNumber, fastest_time([&gridFunc, &coords, &values] ()
+		{
+			gridFunc.interpolate_many_unchecked(coords.data(), values.data(), coords.size(), MultiDimGrid::ParallelSchedule::Static);
+			
+			sink = values.back();
+		}, repetitionNumber), queryNumber);
+		
+		report("integrate", Dim, axisTypeName, threadNumber, pointNumber, fastest_time([&gridFunc] ()
+		{
+			sink = gridFunc.integrate(MultiDimGrid::ParallelSchedule::Static);
+		}, repetitionNumber), pointNumber);
+	}
+	
+	omp_set_num_threads(threadNumbers.back());
+}
+
+template <class Axis, class LastAxis>
+void benchmark_dimensions (const std::string& axisTypeName)
+{
+	benchmark_grid<1, Axis, LastAxis>(axisTypeName);
+	benchmark_grid<2, Axis, LastAxis>(axisTypeName);
+	benchmark_grid<3, Axis, LastAxis>(axisTypeName);
+	benchmark_grid<4, Axis, LastAxis>(axisTypeName);
+	benchmark_grid<5, Axis, LastAxis>(axisTypeName);
+	benchmark_grid<6, Axis, LastAxis>(axisTypeName);
+}
+
+int main()
+{
+	std::cout << "operation,dim,axis_type,threads,points,ns_per_op,ops_per_s" << std::endl;
+	
+	benchmark_dimensions<MultiDimGrid::LinearCoordinateAxis, MultiDimGrid::LinearCoordinateAxis>("Linear");
+	benchmark_dimensions<MultiDimGrid::LogarithmicCoordinateAxis, MultiDimGrid::LogarithmicCoordinateAxis>("Logarithmic");
+	benchmark_dimensions<MultiDimGrid::LinearLogarithmicCoordinateAxis, MultiDimGrid::LinearLogarithmicCoordinateAxis>("LinearLogarithmic");
+	benchmark_dimensions<MultiDimGrid::LinearCoordinateAxis, MultiDimGrid::SinglePointCoordinateAxis>("SinglePoint");
+	
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "BenchmarkUtilities.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * MultiDimGrid query order benchmark:
+ * 
+ * Comparison of the performance of 'interpolate_many_unchecked' at coordinates drawn uniformly from the whole grid when
+ * processing them in the given order and when sorting them by grid cell first, see MultiDimGrid::QueryOrder.
+ * 
+ * The numbers of coordinates range from 'minimumQueryNumber' to 'maximumQueryNumber' in steps of factors of 4, in
+ * order to locate the break-even point above which sorting pays off. The grid functions are:
+ *  - large: about 16 million grid points in 3 and 4 dimensions, stored in the row-major and in the tiled layout, so that
+ *           their function values are much larger than the caches
+ *  - small: 32^3 grid points in the row-major layout, whose function values fit into the caches, so that sorting is
+ *           not expected to pay off at all
+ * 
+ * The results are written to the standard output as comma-separated values, one line per grid function, number of
+ * coordinates and order, containing the time per interpolation in nanoseconds and the number of interpolations per
+ * second.
+ */
+
+const std::size_t minimumQueryNumber = 1024;		// smallest number of coordinates
+const std::size_t maximumQueryNumber = 4194304;	// largest number of coordinates
+const std::size_t repetitionNumber = 3;				// number of timed repetitions, of which the fastest is reported
+
+template <std::size_t Dim>
+void benchmark_order (const MultiDimGrid::GridFunction<Dim>& gridFunc, const std::string& layoutName, const std::vector<MultiDimGrid::Coordinates<Dim>>& coords, const MultiDimGrid::QueryOrder order, const std::string& orderName)
+{
+	std::vector<double> values(coords.size());
+	
+	const double fastestTime = fastest_time([&gridFunc, &coords, &values, order] ()
+	{
+		gridFunc.interpolate_many_unchecked(coords.data(), values.data(), coords.size(), MultiDimGrid::ParallelSchedule::Serial, order);
+	}, repetitionNumber);
+	
+	std::cout << layoutName << "," << Dim << "," << gridFunc.point_number() << "," << coords.size() << "," << orderName << "," << fastestTime / coords.size() << "," << 1.0e9 * coords.size() / fastestTime << "," << values.back() << std::endl;
+}
+
+template <std::size_t Dim>
+void benchmark_query_numbers (const MultiDimGrid::GridFunction<Dim>& gridFunc, const std::string& layoutName)
+{
+	std::mt19937_64 generator(Dim);
+	
+	std::uniform_real_distribution<double> distribution(0.0, 1.0);
+	
+	for ( std::size_t queryNumber = minimumQueryNumber; queryNumber <= maximumQueryNumber; queryNumber *= 4 )
+	{
+		std::vector<MultiDimGrid::Coordinates<Dim>> coords(queryNumber);	// coordinates drawn uniformly from the unit hypercube
+		
+		for ( MultiDimGrid::Coordinates<Dim>& x : coords )
+		{
+			for ( double& coord : x )
+			{
+				coord = distribution(generator);
+			}
+		}
+		
+		benchmark_order(gridFunc, layoutName, coords, MultiDimGrid::QueryOrder::Given, "given");
+		benchmark_order(gridFunc, layoutName, coords, MultiDimGrid::QueryOrder::CellSorted, "cell-sorted");
+	}
+}
+
+template <std::size_t Dim>
+void benchmark_layouts (const std::size_t intervalNumber, const bool withTiledLayout)
+{
+	const MultiDimGrid::LinearCoordinateAxis axis(0.0, 1.0, intervalNumber);	// all axes span the unit interval
+	
+	MultiDimGrid::CoordinateAxisPointers<Dim> axes;
+	
+	axes.fill(&axis);
+	
+	const MultiDimGrid::GridFunction<Dim> rowMajorGridFunc(axes, test_function<Dim>, MultiDimGrid::ParallelSchedule::Static);
+	
+	benchmark_query_numbers(rowMajorGridFunc, "row-major");
+	
+	if ( withTiledLayout )
+	{
+		benchmark_query_numbers(rowMajorGridFunc.with_storage_layout(MultiDimGrid::StorageLayout::Tiled, MultiDimGrid::ParallelSchedule::Static), "tiled");
+	}
+}
+
+int main()
+{
+	std::cout << "layout,dim,points,queries,order,ns_per_op,ops_per_s,checksum" << std::endl;
+	
+	benchmark_layouts<3>(31, false);	// 32^3 grid points
+	benchmark_layouts<3>(255, true);	// 256^3 grid points
+	benchmark_layouts<4>(63, true);		// 64^4 grid points
+	
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include "BenchmarkUtilities.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * MultiDimGrid storage layout benchmark:
+ * 
+ * Comparison of the interpolation performance of grid functions with the function values stored in the row-major and in
+ * the tiled layout, see MultiDimGrid::StorageLayout.
+ * 
+ * Grid functions with about 16 million grid points in 3 and 4 dimensions are interpolated at two streams of coordinates:
+ *  - random:   coordinates drawn uniformly from the whole grid, so that nearly every interpolation misses the caches
+ *  - coherent: coordinates following a random walk with steps of about one grid interval, so that consecutive
+ *              interpolations mostly touch neighbouring grid cells
+ * 
+ * Each stream is interpolated both one coordinate at a time with 'interpolate_unchecked' and as a whole with
+ * 'interpolate_many_unchecked'. The results are written to the standard output as comma-separated values, one line per
+ * layout, dimension, stream and mode, containing the time per interpolation in nanoseconds and the number of
+ * interpolations per second.
+ */
+
+const std::size_t queryNumber = 2000000;	// number of coordinates in each stream
+const std::size_t repetitionNumber = 3;		// number of timed repetitions, of which the fastest is reported
+
+template <std::size_t Dim>
+std::vector<MultiDimGrid::Coordinates<Dim>> random_stream (std::mt19937_64& generator)	// coordinates drawn uniformly from the unit hypercube
+{
+	std::uniform_real_distribution<double> distribution(0.0, 1.0);
+	
+	std::vector<MultiDimGrid::Coordinates<Dim>> coords(queryNumber);
+	
+	for ( MultiDimGrid::Coordinates<Dim>& x : coords )
+	{
+		for ( double& coord : x )
+		{
+			coord = distribution(generator);
+		}
+	}
+	
+	return coords;
+}
+
+template <std::size_t Dim>
+std::vector<MultiDimGrid::Coordinates<Dim>> coherent_stream (std::mt19937_64& generator, const double stepSize)	// coordinates following a random walk reflected at the limits of the unit hypercube
+{
+	std::uniform_real_distribution<double> distribution(-stepSize, stepSize);
+	
+	std::vector<MultiDimGrid::Coordinates<Dim>> coords(queryNumber);
+	
+	MultiDimGrid::Coordinates<Dim> x;
+	
+	x.fill(0.5);
+	
+	for ( MultiDimGrid::Coordinates<Dim>& y : coords )
+	{
+		for ( double& coord : x )
+		{
+			coord += distribution(generator);
+			coord = (coord < 0.0) ? -coord : ((coord > 1.0) ? (2.0 - coord) : coord);
+		}
+		
+		y = x;
+	}
+	
+	return coords;
+}
+
+template <std::size_t Dim>
+void benchmark_stream (const MultiDimGrid::GridFunction<Dim>& gridFunc, const std::string& layoutName, const std::string& streamName, const std::vector<MultiDimGrid::Coordinates<Dim>>& coords)
+{
+	std::vector<double> values(coords.size());
+	
+	double checksum = 0.0;	// sum of the interpolated values, which keeps the scalar interpolations from being optimized away
+	
+	const double scalarTime = fastest_time([&gridFunc, &coords, &checksum] ()
+	{
+		for ( const MultiDimGrid::Coordinates<Dim>& x : coords )
+		{
+			checksum += gridFunc.interpolate_unchecked(x);
+		}
+	}, repetitionNumber);
+	
+	const double batchTime = fastest_time([&gridFunc, &coords, &values, &checksum] ()
+	{
+		gridFunc.interpolate_many_unchecked(coords.data(), values.data(), coords.size());
+		
+		checksum += values.back();
+	}, repetitionNumber);
+	
+	std::cout << layoutName << "," << Dim << "," << streamName << ",scalar," << scalarTime / coords.size() << "," << 1.0e9 * coords.size() / scalarTime << "," << checksum << std::endl
+			  << layoutName << "," << Dim << "," << streamName << ",batch,"  << batchTime / coords.size()  << "," << 1.0e9 * coords.size() / batchTime  << "," << checksum << std::endl;
+}
+
+template <std::size_t Dim>
+void benchmark_layouts (const std::size_t intervalNumber)
+{
+	const MultiDimGrid::LinearCoordinateAxis axis(0.0, 1.0, intervalNumber);	// all axes span the unit interval
+	
+	MultiDimGrid::CoordinateAxisPointers<Dim> axes;
+	
+	axes.fill(&axis);
+	
+	const MultiDimGrid::GridFunction<Dim> rowMajorGridFunc(axes, test_function<Dim>, MultiDimGrid::ParallelSchedule::Static);
+	const MultiDimGrid::GridFunction<Dim> tiledGridFunc = rowMajorGridFunc.with_storage_layout(MultiDimGrid::StorageLayout::Tiled, MultiDimGrid::ParallelSchedule::Static);
+	
+	std::mt19937_64 generator(Dim);
+	
+	const std::vector<MultiDimGrid::Coordinates<Dim>> randomCoords = random_stream<Dim>(generator);
+	const std::vector<MultiDimGrid::Coordinates<Dim>> coherentCoords = coherent_stream<Dim>(generator, 1.0 / intervalNumber);
+	
+	benchmark_stream(rowMajorGridFunc, "row-major", "random", randomCoords);
+	benchmark_stream(tiledGridFunc, "tiled", "random", randomCoords);
+	benchmark_stream(rowMajorGridFunc, "row-major", "coherent", coherentCoords);
+	benchmark_stream(tiledGridFunc, "tiled", "coherent", coherentCoords);
+}
+
+int main()
+{
+	std::cout << "layout,dim,stream,mode,ns_per_op,ops_per_s,checksum" << std::endl;
+	
+	benchmark_layouts<3>(255);	// 256^3 grid points
+	benchmark_layouts<4>(63);	// 64^4 grid points
+	
+	return 0;
+}
\ No newline at end of file
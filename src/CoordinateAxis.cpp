@@ -1,7 +1,13 @@
 #include "CoordinateAxis.hpp"
 
+#include <cmath>
 #include <iostream>
 
+#include "LinearCoordinateAxis.hpp"
+#include "LinearLogarithmicCoordinateAxis.hpp"
+#include "LogarithmicCoordinateAxis.hpp"
+#include "SinglePointCoordinateAxis.hpp"
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // public
 
@@ -24,6 +30,13 @@ double MultiDimGrid::CoordinateAxis::integration_weight (const std::size_t axisP
 	return integration_weight_unchecked(axisPoint);
 }
 
+MultiDimGrid::AxisLocation MultiDimGrid::CoordinateAxis::locate (const double coord) const
+{
+	check_coordinate(coord, "locate");
+	
+	return locate_unchecked(coord);
+}
+
 double MultiDimGrid::CoordinateAxis::interpolation_weight (const double coord) const
 {
 	check_coordinate(coord, "interpolation_weight");
@@ -31,6 +44,18 @@ double MultiDimGrid::CoordinateAxis::interpolation_weight (const double coord) c
 	return interpolation_weight_unchecked(coord);
 }
 
+double MultiDimGrid::CoordinateAxis::interpolation_weight_unchecked (const double coord) const
+{
+	return locate_unchecked(coord).InterpolationWeight;
+}
+
+double MultiDimGrid::CoordinateAxis::interpolation_weight_derivative (const double coord) const
+{
+	check_coordinate(coord, "interpolation_weight_derivative");
+	
+	return interpolation_weight_derivative_unchecked(coord);
+}
+
 std::size_t MultiDimGrid::CoordinateAxis::nearest_lower_axis_point (const double coord) const
 {
 	check_coordinate(coord, "nearest_lower_axis_point");
@@ -38,6 +63,11 @@ std::size_t MultiDimGrid::CoordinateAxis::nearest_lower_axis_point (const double
 	return nearest_lower_axis_point_unchecked(coord);
 }
 
+std::size_t MultiDimGrid::CoordinateAxis::nearest_lower_axis_point_unchecked (const double coord) const
+{
+	return locate_unchecked(coord).LowerAxisPoint;
+}
+
 std::size_t MultiDimGrid::CoordinateAxis::nearest_higher_axis_point (const double coord) const
 {
 	check_coordinate(coord, "nearest_higher_axis_point");
@@ -45,6 +75,11 @@ std::size_t MultiDimGrid::CoordinateAxis::nearest_higher_axis_point (const doubl
 	return nearest_higher_axis_point_unchecked(coord);
 }
 
+std::size_t MultiDimGrid::CoordinateAxis::nearest_higher_axis_point_unchecked (const double coord) const
+{
+	return locate_unchecked(coord).HigherAxisPoint;
+}
+
 double MultiDimGrid::CoordinateAxis::lower_coordinate_limit () const
 {
 	return LowerCoordinateLimit;
@@ -65,6 +100,80 @@ std::size_t MultiDimGrid::CoordinateAxis::point_number () const
 	return PointNumber;
 }
 
+MultiDimGrid::AxisDescription MultiDimGrid::CoordinateAxis::description () const
+{
+	return {AxisType::Custom, LowerCoordinateLimit, UpperCoordinateLimit, 0.0, IntervalNumber, 0};
+}
+
+MultiDimGrid::CoordinateAxisCounters MultiDimGrid::CoordinateAxis::instrumentation_counters () const
+{
+	return {Counters.total(CoordinateCheckCounter), Counters.total(AxisPointCheckCounter)};
+}
+
+void MultiDimGrid::CoordinateAxis::reset_instrumentation_counters () const
+{
+	Counters.reset();
+}
+
+MultiDimGrid::CoordinateAxis* MultiDimGrid::create_coordinate_axis (const AxisDescription& axisDescription)
+{
+	switch ( axisDescription.Type )
+	{
+		case AxisType::Linear:
+			return new LinearCoordinateAxis(axisDescription.LowerCoordinateLimit, axisDescription.UpperCoordinateLimit, axisDescription.IntervalNumber);
+		
+		case AxisType::Logarithmic:
+			return new LogarithmicCoordinateAxis(axisDescription.LowerCoordinateLimit, axisDescription.UpperCoordinateLimit, axisDescription.IntervalNumber);
+		
+		case AxisType::LinearLogarithmic:
+			return new LinearLogarithmicCoordinateAxis(axisDescription.LowerCoordinateLimit, axisDescription.SpacingThresholdValue, axisDescription.UpperCoordinateLimit, axisDescription.LinearIntervalNumber, axisDescription.IntervalNumber - axisDescription.LinearIntervalNumber);
+		
+		case AxisType::SinglePoint:
+			return new SinglePointCoordinateAxis(axisDescription.LowerCoordinateLimit);
+		
+		case AxisType::Custom:
+			std::cout << std::endl
+					  << " MultiDimGrid::create_coordinate_axis Error: Custom coordinate axes can not be reconstructed from their description" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+	}
+	
+	std::cout << std::endl
+			  << " MultiDimGrid::create_coordinate_axis Error: Unknown coordinate axis type" << std::endl
+			  << std::endl;
+	
+	exit(EXIT_FAILURE);
+}
+
+MultiDimGrid::CoordinateAxis* MultiDimGrid::create_refined_coordinate_axis (const CoordinateAxis& coordAxis, const std::size_t refinementFactor)
+{
+	if ( refinementFactor == 0 )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::create_refined_coordinate_axis Error: Refinement factor is zero" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+	
+	AxisDescription axisDescription = coordAxis.description();
+	
+	if ( axisDescription.Type == AxisType::Custom )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::create_refined_coordinate_axis Error: Custom coordinate axes can not be refined" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+	
+	axisDescription.IntervalNumber *= refinementFactor;	// every interval is split into 'refinementFactor' intervals of equal width in the coordinate spacing, which keeps the original axis points
+	axisDescription.LinearIntervalNumber *= refinementFactor;
+	
+	return create_coordinate_axis(axisDescription);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // protected
 
@@ -72,7 +181,8 @@ MultiDimGrid::CoordinateAxis::CoordinateAxis (const double lowerCoordinateLimit,
 	LowerCoordinateLimit(lowerCoordinateLimit),
 	UpperCoordinateLimit(upperCoordinateLimit),
 	IntervalNumber(intervalNumber),
-	PointNumber(IntervalNumber + 1)
+	PointNumber(IntervalNumber + 1),
+	Counters()
 {
 	if ( UpperCoordinateLimit < LowerCoordinateLimit )
 	{
@@ -113,6 +223,8 @@ MultiDimGrid::CoordinateAxis::CoordinateAxis (const double lowerCoordinateLimit,
 
 void MultiDimGrid::CoordinateAxis::check_axis_point (const std::size_t axisPoint, const char* location) const
 {
+	Counters.add(AxisPointCheckCounter, 1);
+	
 	if ( (axisPoint < 0) || (axisPoint >= PointNumber) )
 	{
 		std::cout << std::endl
@@ -125,6 +237,8 @@ void MultiDimGrid::CoordinateAxis::check_axis_point (const std::size_t axisPoint
 
 void MultiDimGrid::CoordinateAxis::check_coordinate (const double coord, const char* location) const
 {
+	Counters.add(CoordinateCheckCounter, 1);
+	
 	if ( (coord < LowerCoordinateLimit) || (coord > UpperCoordinateLimit) )
 	{
 		std::cout << std::endl
@@ -135,5 +249,32 @@ void MultiDimGrid::CoordinateAxis::check_coordinate (const double coord, const c
 	}
 }
 
+MultiDimGrid::AxisLocation MultiDimGrid::CoordinateAxis::locate_interpolated_axis_point (const double interpolatedAxisPoint) const
+{
+	if ( !(interpolatedAxisPoint > 0.0) )	// coordinates at (or, due to rounding errors, slightly below) the lower coordinate limit coincide with the first axis point
+	{
+		return {0, 0, 0.0};
+	}
+	
+	if ( interpolatedAxisPoint >= IntervalNumber )	// coordinates at (or, due to rounding errors, slightly above) the upper coordinate limit coincide with the last axis point
+	{
+		return {IntervalNumber, IntervalNumber, 0.0};
+	}
+	
+	const double roundedDownAxisPoint = std::floor(interpolatedAxisPoint);
+	
+	const std::size_t lowerAxisPoint = std::size_t(roundedDownAxisPoint);
+	const double interpolationWeight = interpolatedAxisPoint - roundedDownAxisPoint;	// the interpolation weight is the distance to the nearest lower axis point relative to the distance between neighbouring axis points, both measured in the coordinate spacing
+	
+	if ( interpolationWeight > 0.0 )
+	{
+		return {lowerAxisPoint, lowerAxisPoint + 1, interpolationWeight};
+	}
+	else	// the coordinate coincides with an axis point
+	{
+		return {lowerAxisPoint, lowerAxisPoint, 0.0};
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // private
\ No newline at end of file
@@ -2,9 +2,87 @@
 #define MULTIDIMGRID_COORDINATE_AXIS_H
 
 #include <cstddef>
+#include <cstdint>
+
+#include "Instrumentation.hpp"
 
 namespace MultiDimGrid
 {
+	/**
+	 * Position of a coordinate relative to the axis points of a CoordinateAxis, as returned by CoordinateAxis::locate.
+	 */
+	struct AxisLocation
+	{
+		/**
+		 * Nearest axis point that has a coordinate smaller than or equal to the located coordinate.
+		 */
+		std::size_t LowerAxisPoint;
+		
+		/**
+		 * Nearest axis point that has a coordinate larger than or equal to the located coordinate.
+		 */
+		std::size_t HigherAxisPoint;
+		
+		/**
+		 * Interpolation weight of the located coordinate corresponding to an interpolation linear in the coordinate spacing.
+		 */
+		double InterpolationWeight;
+	};
+	
+	/**
+	 * Types of the coordinate axes provided by this library, as stored in an AxisDescription. AxisType::Custom denotes
+	 * any coordinate axis derived from CoordinateAxis outside of this library, which can not be reconstructed from its
+	 * description.
+	 * 
+	 * The numerical values are part of the binary file format of GridFunction and must therefore never be changed.
+	 */
+	enum class AxisType : std::uint32_t
+	{
+		Custom = 0,
+		Linear = 1,
+		Logarithmic = 2,
+		LinearLogarithmic = 3,
+		SinglePoint = 4
+	};
+	
+	/**
+	 * Complete description of a coordinate axis, as returned by CoordinateAxis::description. It contains all parameters
+	 * needed to reconstruct the axis, which allows to store it in a file.
+	 */
+	struct AxisDescription
+	{
+		/**
+		 * Type of the coordinate axis.
+		 */
+		AxisType Type;
+		
+		/**
+		 * Lower coordinate limit.
+		 */
+		double LowerCoordinateLimit;
+		
+		/**
+		 * Upper coordinate limit.
+		 */
+		double UpperCoordinateLimit;
+		
+		/**
+		 * Coordinate value separating the linear from the logarithmic part of a LinearLogarithmicCoordinateAxis. Unused
+		 * for all other types.
+		 */
+		double SpacingThresholdValue;
+		
+		/**
+		 * Total number of axis intervals.
+		 */
+		std::size_t IntervalNumber;
+		
+		/**
+		 * Number of linearly spaced axis intervals of a LinearLogarithmicCoordinateAxis. Unused for all other types.
+		 */
+		std::size_t LinearIntervalNumber;
+	};
+	
 	/**
 	 * \brief Abstract base class for coordinate axes.
 	 * 
@@ -55,6 +133,24 @@ namespace MultiDimGrid
 		 */
 		virtual double integration_weight_unchecked (std::size_t axisPoint) const = 0;
 		
+		/**
+		 * Returns the nearest lower and higher axis points of the coordinate \a coord as well as its interpolation weight
+		 * corresponding to an interpolation linear in the coordinate spacing.
+		 */
+		AxisLocation locate (double coord) const;
+		
+		/**
+		 * Returns the nearest lower and higher axis points of the coordinate \a coord as well as its interpolation weight
+		 * corresponding to an interpolation linear in the coordinate spacing.
+		 * 
+		 * All three are derived from a single inversion of the mapping from axis points to coordinate values, which makes
+		 * this the preferred way of looking up a coordinate if more than one of them is needed.
+		 * 
+		 * In contrast to CoordinateAxis::locate, this method does not check if \a coord is within the range of the axis.
+		 * It is thus slightly faster, but unsafe!
+		 */
+		virtual AxisLocation locate_unchecked (double coord) const = 0;
+		
 		/**
 		 * Returns the interpolation weight of the coordinate \a coord corresponding to an interpolation linear in the
 		 * coordinate spacing.
@@ -68,7 +164,24 @@ namespace MultiDimGrid
 		 * In contrast to CoordinateAxis::interpolation_weight, this method does not check if \a coord is within the range
 		 * of the axis. It is thus slightly faster, but unsafe!
 		 */
-		virtual double interpolation_weight_unchecked (double coord) const = 0;
+		double interpolation_weight_unchecked (double coord) const;
+		
+		/**
+		 * Returns the derivative of the interpolation weight of the coordinate \a coord with respect to the coordinate,
+		 * i.e. the factor converting derivatives of an interpolation linear in the coordinate spacing into derivatives with
+		 * respect to the coordinate.
+		 */
+		double interpolation_weight_derivative (double coord) const;
+		
+		/**
+		 * Returns the derivative of the interpolation weight of the coordinate \a coord with respect to the coordinate,
+		 * i.e. the factor converting derivatives of an interpolation linear in the coordinate spacing into derivatives with
+		 * respect to the coordinate.
+		 * 
+		 * In contrast to CoordinateAxis::interpolation_weight_derivative, this method does not check if \a coord is within
+		 * the range of the axis. It is thus slightly faster, but unsafe!
+		 */
+		virtual double interpolation_weight_derivative_unchecked (double coord) const = 0;
 		
 		/**
 		 * Returns the nearest axis point that has a coordinate smaller than or equal to \a coord.
@@ -81,7 +194,7 @@ namespace MultiDimGrid
 		 * In contrast to CoordinateAxis::nearest_lower_axis_point, this method does not check if \a coord is within the
 		 * range of the axis. It is thus slightly faster, but unsafe!
 		 */
-		virtual std::size_t nearest_lower_axis_point_unchecked (double coord) const = 0;
+		std::size_t nearest_lower_axis_point_unchecked (double coord) const;
 		
 		/**
 		 * Returns the nearest axis point that has a coordinate larger than or equal to \a coord.
@@ -94,7 +207,7 @@ namespace MultiDimGrid
 		 * In contrast to CoordinateAxis::nearest_higher_axis_point, this method does not check if \a coord is within the
 		 * range of the axis. It is thus slightly faster, but unsafe!
 		 */
-		virtual std::size_t nearest_higher_axis_point_unchecked (double coord) const = 0;
+		std::size_t nearest_higher_axis_point_unchecked (double coord) const;
 		
 		/**
 		 * Returns the lower coordinate limit of the axis.
@@ -116,6 +229,15 @@ namespace MultiDimGrid
 		 */
 		std::size_t point_number () const;
 		
+		/**
+		 * Returns the complete description of this coordinate axis, from which it can be reconstructed using MultiDimGrid::create_coordinate_axis.
+		 * 
+		 * By default, the description is of type AxisType::Custom and only contains the coordinate limits and the number
+		 * of axis intervals. Such an axis can neither be reconstructed nor refined, nor can grid functions defined on it
+		 * be written to files or published in shared memory.
+		 */
+		virtual AxisDescription description () const;
+		
 		/**
 		 * Dynamically creates a copy of this coordinate axis, using the copy-constructor, and returns a pointer to
 		 * it.
@@ -125,6 +247,16 @@ namespace MultiDimGrid
 		 */
 		virtual CoordinateAxis* clone () const = 0;
 		
+		/**
+		 * Returns a snapshot of the instrumentation counters of this coordinate axis, see MultiDimGrid::InstrumentationEnabled.
+		 */
+		CoordinateAxisCounters instrumentation_counters () const;
+		
+		/**
+		 * Resets the instrumentation counters of this coordinate axis to zero.
+		 */
+		void reset_instrumentation_counters () const;
+		
 		/**
 		 * Default destructor.
 		 * 
@@ -170,6 +302,21 @@ namespace MultiDimGrid
 		 */
 		std::size_t PointNumber;
 		
+		/**
+		 * Indices of the instrumentation counters of a coordinate axis.
+		 */
+		enum InstrumentationCounter : std::size_t
+		{
+			CoordinateCheckCounter,
+			AxisPointCheckCounter,
+			InstrumentationCounterNumber
+		};
+		
+		/**
+		 * Instrumentation counters, which are updated by the checked methods, including const ones.
+		 */
+		mutable InstrumentationCounters<InstrumentationCounterNumber> Counters;
+		
 		/**
 		 * Checks if the axis point \a axisPoint is out of range. If that is the case, an error message is written to the
 		 * standard output and the program is terminated. The error message contains \a location, which specifies in which
@@ -183,7 +330,29 @@ namespace MultiDimGrid
 		 * the coordinate range is checked.
 		 */
 		void check_coordinate (double coord, const char* location) const;
+		
+		/**
+		 * Returns the location of a coordinate given the corresponding interpolated axis point \a interpolatedAxisPoint,
+		 * i.e. the result of inverting the mapping from axis points to coordinate values for that coordinate. Values of
+		 * \a interpolatedAxisPoint outside of the range of the axis are clamped to it.
+		 * 
+		 * This implements the part of CoordinateAxis::locate_unchecked common to all coordinate axes whose mapping from
+		 * axis points to coordinate values is invertible in closed form.
+		 */
+		AxisLocation locate_interpolated_axis_point (double interpolatedAxisPoint) const;
 	};
+	
+	/**
+	 * Dynamically creates the coordinate axis described by \a axisDescription and returns a pointer to it.
+	 */
+	CoordinateAxis* create_coordinate_axis (const AxisDescription& axisDescription);
+	
+	/**
+	 * Dynamically creates a coordinate axis of the same type and range as \a coordAxis, but with \a refinementFactor
+	 * times as many axis intervals, and returns a pointer to it. All axis points of \a coordAxis are also axis points
+	 * of the refined axis. A single-point axis is copied unchanged. Axes of type AxisType::Custom can not be refined.
+	 */
+	CoordinateAxis* create_refined_coordinate_axis (const CoordinateAxis& coordAxis, std::size_t refinementFactor);
 }
 
 #endif
\ No newline at end of file
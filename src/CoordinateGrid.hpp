@@ -0,0 +1,404 @@
+#ifndef MULTIDIMGRID_COORDINATE_GRID_H
+#define MULTIDIMGRID_COORDINATE_GRID_H
+
+#include "CoordinateAxis.hpp"
+#include "GridFunctionFile.hpp"
+#include "Parallelization.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace MultiDimGrid
+{
+	/**
+	 * Arrays of integer values of length \a Length are implemented as \c std::size_t \c std::arrays.
+	 */
+	template <std::size_t Length>
+	using IntegerArray = std::array<std::size_t, Length>;
+	
+	/**
+	 * Arrays of real values of length \a Length are implemented as \c double \c std::arrays.
+	 */
+	template <std::size_t Length>
+	using DoubleArray = std::array<double, Length>;
+	
+	/**
+	 * A grid point is expected to be specified as a MultiDimGrid::IntegerArray<\a Dim>.
+	 */
+	template <std::size_t Dim>
+	using GridPoint = IntegerArray<Dim>;
+	
+	/**
+	 * Coordinates are expected to be specified as a MultiDimGrid::DoubleArray<\a Dim>.
+	 */
+	template <std::size_t Dim>
+	using Coordinates = DoubleArray<Dim>;
+	
+	/**
+	 * The coordinate axes of a grid are expected to be specified as a CoordinateAxis pointer \c std::array of length
+	 * \a Dim.
+	 */
+	template <std::size_t Dim>
+	using CoordinateAxisPointers = std::array<const CoordinateAxis*, Dim>;
+	
+	/**
+	 * Internally, the coordinate axes of a grid are held as a \c std::shared_ptr to \c const CoordinateAxis \c std::array
+	 * of length \a Dim. As the axes are immutable, they can be shared between all grids spanned up by them.
+	 */
+	template <std::size_t Dim>
+	using SharedCoordinateAxisPointers = std::array<std::shared_ptr<const CoordinateAxis>, Dim>;
+	
+	/**
+	 * Box of grid points, consisting of all grid points whose axis points lie between those of LowerGridPoint (inclusively)
+	 * and UpperGridPoint (exclusively) along every axis.
+	 */
+	template <std::size_t Dim>
+	struct GridPointRange
+	{
+		/**
+		 * Lowest grid point of the box.
+		 */
+		GridPoint<Dim> LowerGridPoint;
+		
+		/**
+		 * Grid point whose axis points lie just above the highest ones of the box along every axis.
+		 */
+		GridPoint<Dim> UpperGridPoint;
+	};
+	
+	/**
+	 * Grid point visited by CoordinateGrid::for_each_point, together with the quantities usually needed at it.
+	 */
+	template <std::size_t Dim>
+	struct GridPointVisit
+	{
+		/**
+		 * Grid point.
+		 */
+		GridPoint<Dim> Point;
+		
+		/**
+		 * Index of the grid point.
+		 */
+		std::size_t Index;
+		
+		/**
+		 * Coordinates of the grid point.
+		 */
+		Coordinates<Dim> Coords;
+		
+		/**
+		 * Product of the integration weights of the grid point corresponding to all coordinate axes.
+		 */
+		double IntegrationWeight;
+	};
+	
+	/**
+	 * \brief Class describing a multi-dimensional coordinate grid.
+	 * 
+	 * The grid is spanned up by an arbitrary number of coordinate axes with each axis having a custom range and spacing.
+	 * Its grid points are enumerated in the nested fashion described in GridFunction::FunctionValues. It allows to extract
+	 * the coordinates and integration weights of each grid point and to locate the grid cell containing some coordinates.
+	 * 
+	 * This is the common base of the discrete functions defined on such a grid, GridFunction and MultiFieldGridFunction.
+	 */
+	template <std::size_t Dim>
+	class CoordinateGrid
+	{
+	public:
+		/**
+		 * Constructor instantiating a grid spanned up by copies of the coordinate axes pointed to by the \a coordAxisPointers.
+		 */
+		CoordinateGrid (const CoordinateAxisPointers<Dim>& coordAxisPointers);
+		
+		/**
+		 * Constructor instantiating a grid spanned up by the shared coordinate axes pointed to by the \a sharedCoordAxes,
+		 * without copying them.
+		 */
+		CoordinateGrid (const SharedCoordinateAxisPointers<Dim>& sharedCoordAxes);
+		
+		/**
+		 * Constructor instantiating a grid spanned up by the coordinate axes described by the \a axisDescriptions.
+		 */
+		CoordinateGrid (const std::vector<AxisDescription>& axisDescriptions);
+		
+		/**
+		 * Returns the coordinates of the grid point \a gridPoint.
+		 */
+		Coordinates<Dim> coordinates (const GridPoint<Dim>& gridPoint) const;
+		
+		/**
+		 * Returns the coordinates of the grid point \a gridPoint.
+		 * 
+		 * In contrast to CoordinateGrid::coordinates, this method does not check if \a gridPoint is within the range of the
+		 * grid. It is thus slightly faster, but unsafe!
+		 */
+		Coordinates<Dim> coordinates_unchecked (const GridPoint<Dim>& gridPoint) const;
+		
+		/**
+		 * Returns the coordinates of the grid point with index \a index.
+		 */
+		Coordinates<Dim> coordinates_at_index (std::size_t index) const;
+		
+		/**
+		 * Returns the coordinates of the grid point with index \a index.
+		 * 
+		 * In contrast to CoordinateGrid::coordinates_at_index, this method does not check if \a index is within the range
+		 * of the grid. It is thus slightly faster, but unsafe!
+		 */
+		Coordinates<Dim> coordinates_at_index_unchecked (std::size_t index) const;
+		
+		/**
+		 * Returns the integration weights corresponding to the individual coordinate axes at the grid point \a gridPoint.
+		 */
+		DoubleArray<Dim> integration_weights (const GridPoint<Dim>& gridPoint) const;
+		
+		/**
+		 * Returns the integration weights corresponding to the individual coordinate axes at the grid point \a gridPoint.
+		 * 
+		 * In contrast to CoordinateGrid::integration_weight, this method does not check if \a gridPoint is within the range
+		 * of the grid. It is thus slightly faster, but unsafe!
+		 */
+		DoubleArray<Dim> integration_weights_unchecked (const GridPoint<Dim>& gridPoint) const;
+		
+		/**
+		 * Returns the integration weights corresponding to the individual coordinate axes at the grid point with index
+		 * \a index.
+		 */
+		DoubleArray<Dim> integration_weights_at_index (std::size_t index) const;
+		
+		/**
+		 * Returns the integration weights corresponding to the individual coordinate axes at the grid point with index
+		 * \a index.
+		 * 
+		 * In contrast to CoordinateGrid::integration_weight_at_index, this method does not check if \a index is within the
+		 * range of the grid. It is thus slightly faster, but unsafe!
+		 */
+		DoubleArray<Dim> integration_weights_at_index_unchecked (std::size_t index) const;
+		
+		/**
+		 * Returns a reference to the coordinate axis with index \a i_axis.
+		 */
+		const CoordinateAxis& coordinate_axis (std::size_t i_axis) const;
+		
+		/**
+		 * Returns the index differences between neighbouring grid points along each coordinate axis.
+		 * 
+		 * This might be useful, if one wants to work with indices of grid points instead of the grid points themselves.
+		 */
+		IntegerArray<Dim> index_strides () const;
+		
+		/**
+		 * Returns the total number of grid points.
+		 * 
+		 * This might be useful, if one wants to work with indices of grid points instead of the grid points themselves.
+		 */
+		double point_number () const;
+		
+		/**
+		 * Returns the descriptions of all coordinate axes, from which the grid can be reconstructed.
+		 */
+		std::vector<AxisDescription> axis_descriptions () const;
+		
+		/**
+		 * Returns shared pointers to the coordinate axes, which allows to span up further grids with them without copying
+		 * them.
+		 */
+		const SharedCoordinateAxisPointers<Dim>& shared_coordinate_axes () const;
+		
+		/**
+		 * Returns the box containing all grid points.
+		 */
+		GridPointRange<Dim> grid_point_range () const;
+		
+		/**
+		 * Calls \a body(visit) once for every grid point, where \a visit is a const reference to a MultiDimGrid::GridPointVisit
+		 * describing the grid point. The calls are distributed among OpenMP threads according to \a schedule.
+		 * 
+		 * See CoordinateGrid::for_each_point(const GridPointRange<Dim>&, const Body&, ParallelSchedule) const for details.
+		 */
+		template <class Body>
+		void for_each_point (const Body& body, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Calls \a body(visit) once for every grid point within the box \a range, where \a visit is a const reference to
+		 * a MultiDimGrid::GridPointVisit describing the grid point. The calls are distributed among OpenMP threads according
+		 * to \a schedule.
+		 * 
+		 * The grid points are visited in the order of their indices by advancing their axis points like an odometer, so
+		 * that only the quantities corresponding to the axes whose axis points changed are updated, and without any integer
+		 * divisions or calls of the coordinate axes. This is considerably faster than iterating over the indices and using
+		 * CoordinateGrid::coordinates_at_index and CoordinateGrid::integration_weights_at_index. For the parallel iteration,
+		 * the box is split into at most CoordinateGrid::IterationChunkNumber chunks of consecutive grid points, i.e. it is
+		 * split along the outermost axes first, and each chunk is visited in order by a single thread.
+		 * 
+		 * \a body must be safe to call concurrently for different grid points unless \a schedule is ParallelSchedule::Serial.
+		 */
+		template <class Body>
+		void for_each_point (const GridPointRange<Dim>& range, const Body& body, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+	
+	protected:
+		/**
+		 * Number of grid points surrounding the coordinates in an interpolation, i.e. the number of corners of a grid cell.
+		 */
+		static constexpr std::size_t CornerNumber = std::size_t(1) << Dim;
+		
+		/**
+		 * Maximum number of chunks into which the grid points are split by a parallel CoordinateGrid::for_each_point.
+		 */
+		static constexpr std::size_t IterationChunkNumber = 1024;
+		
+		/**
+		 * Coordinate axes spanning up the grid.
+		 */
+		SharedCoordinateAxisPointers<Dim> CoordAxes;
+		
+		/**
+		 * Index differences between neighbouring grid points along each coordinate axis.
+		 * 
+		 * If there are n axes, the indices of the grid points (i_0, ... , i_j, ... , i_(n-1)) and (i_0, ... , i_j + 1, ... , i_(n-1)),
+		 * for example, differ by (num_axis_pts_(j+1) * ... * num_axis_pts_(n-1)). This value is stored in CoordinateGrid::IndexStrides[j].
+		 */
+		IntegerArray<Dim> IndexStrides;
+		
+		/**
+		 * Index differences between the corners of a grid cell and its lowest corner.
+		 * 
+		 * The corners are enumerated such that the j-th bit of the corner number states whether the corner lies at the
+		 * higher axis point of the axis with index (Dim-1-j), so corners whose function values are adjacent in memory
+		 * have consecutive numbers. Along single-point axes the higher and lower axis points coincide.
+		 */
+		IntegerArray<CornerNumber> CornerOffsets;
+		
+		/**
+		 * Total number of grid points.
+		 */
+		std::size_t GridPointNumber;
+		
+		/**
+		 * Determines the grid cell that contains the coordinates \a coords. Returns the index of its lowest corner and
+		 * writes the interpolation weights of \a coords within the cell along each axis to \a interpolationWeights.
+		 * 
+		 * This method does not check if \a coords are within the range of the grid.
+		 */
+		std::size_t locate_cell (const Coordinates<Dim>& coords, DoubleArray<Dim>& interpolationWeights) const;
+		
+		/**
+		 * Determines the grid cell along the axis with index \a i_axis that contains the coordinate \a coord. Returns the
+		 * lower axis point of this cell and writes the interpolation weight of \a coord within the cell to \a interpolationWeight.
+		 * 
+		 * In contrast to CoordinateAxis::nearest_lower_axis_point, the returned axis point is never the last one of an axis
+		 * with more than one point, so that the higher axis point of the cell is always part of the grid.
+		 */
+		std::size_t locate_cell_axis_point (std::size_t i_axis, double coord, double& interpolationWeight) const;
+		
+		/**
+		 * Returns the lower axis point of the grid cell containing a coordinate that has been located at \a location on an
+		 * axis with \a axisPointNumber points and writes its interpolation weight within the cell to \a interpolationWeight.
+		 * 
+		 * This implements the assignment of a coordinate at the upper limit of an axis to its last interval for
+		 * CoordinateGrid::locate_cell_axis_point and for callers which locate the coordinate themselves.
+		 */
+		static std::size_t cell_axis_point (const AxisLocation& location, std::size_t axisPointNumber, double& interpolationWeight);
+		
+		/**
+		 * Interpolates between the function values at the corners of a grid cell stored in the array \a cornerValues,
+		 * ordered as described in CoordinateGrid::CornerOffsets, using the interpolation weights \a interpolationWeights
+		 * along each axis, and returns the result. The content of \a cornerValues is overwritten in the process.
+		 */
+		static double interpolate_corner_values (double* cornerValues, const DoubleArray<Dim>& interpolationWeights);
+		
+		/**
+		 * Interpolates between the function values at the corners of a grid cell like CoordinateGrid::interpolate_corner_values(double*, const DoubleArray<Dim>&),
+		 * but leaves the content of \a cornerValues unchanged. The first step of the interpolation writes its results to
+		 * the array \a halvedCornerValues of half the number of corners instead, in which the remaining steps are carried
+		 * out.
+		 */
+		static double interpolate_corner_values (const double* cornerValues, double* halvedCornerValues, const DoubleArray<Dim>& interpolationWeights);
+		
+		/**
+		 * Returns the integration weights of all axis points of the coordinate axis with index \a i_axis.
+		 */
+		std::vector<double> axis_integration_weights (std::size_t i_axis) const;
+		
+		/**
+		 * Returns the coordinates of all axis points of the coordinate axis with index \a i_axis.
+		 */
+		std::vector<double> axis_coordinates (std::size_t i_axis) const;
+		
+		/**
+		 * Checks if the axis point \a axisPoint of the coordinate axis pointed to by \a axis is out of range. If that is
+		 * the case, an error message is written to the standard output and the program is terminated. The error message
+		 * contains \a location, which specifies in which member, qualified by its class, the point range is checked.
+		 */
+		void check_axis_point (std::size_t axisPoint, const CoordinateAxis* axis, const char* location) const;
+		
+		/**
+		 * Checks if the coordinate \a coord of the coordinate axis pointed to by \a axis is out of range. If that is the
+		 * case, an error message is written to the standard output and the program is terminated. The error message contains
+		 * \a location, which specifies in which member, qualified by its class, the coordinate range is checked.
+		 */
+		void check_coordinate (double coord, const CoordinateAxis* axis, const char* location) const;
+		
+		/**
+		 * Checks if any of the coordinates \a coords is out of the range of its coordinate axis, using CoordinateGrid::check_coordinate
+		 * with \a location.
+		 */
+		void check_coordinates (const Coordinates<Dim>& coords, const char* location) const;
+		
+		/**
+		 * Checks if the index \a index is out of range. If that is the case, an error message is written to the standard
+		 * output and the program is terminated. The error message contains \a location, which specifies in which member,
+		 * qualified by its class, the index range is checked.
+		 */
+		void check_index (std::size_t index, const char* location) const;
+		
+		/**
+		 * Checks if the box \a range is not contained in the grid or if its lower grid point lies above its upper one along
+		 * any axis. If that is the case, an error message is written to the standard output and the program is terminated.
+		 * The error message contains \a location, which specifies in which member, qualified by its class, the box is checked.
+		 */
+		void check_grid_point_range (const GridPointRange<Dim>& range, const char* location) const;
+	
+	private:
+		/**
+		 * Creates copies of the coordinate axes pointed to by the \a coordAxisPointers and returns MultiDimGrid::SharedCoordinateAxisPointers
+		 * to them.
+		 */
+		SharedCoordinateAxisPointers<Dim> copy_coordinate_axes (const CoordinateAxisPointers<Dim>& coordAxisPointers) const;
+		
+		/**
+		 * Dynamically creates the coordinate axes described by the \a axisDescriptions and returns MultiDimGrid::SharedCoordinateAxisPointers
+		 * to them.
+		 */
+		SharedCoordinateAxisPointers<Dim> create_coordinate_axes (const std::vector<AxisDescription>& axisDescriptions) const;
+		
+		/**
+		 * Computes and returns the index stride values corresponding the coordinate axes pointed to by the \a sharedCoordAxes.
+		 */
+		IntegerArray<Dim> compute_index_strides (const SharedCoordinateAxisPointers<Dim>& sharedCoordAxes) const;
+		
+		/**
+		 * Computes and returns the corner offset values corresponding to the coordinate axes pointed to by the \a sharedCoordAxes
+		 * and the index strides \a indexStrides.
+		 */
+		IntegerArray<CornerNumber> compute_corner_offsets (const SharedCoordinateAxisPointers<Dim>& sharedCoordAxes, const IntegerArray<Dim>& indexStrides) const;
+		
+		/**
+		 * Calls \a body for \a pointNumber consecutive grid points of the box \a range, starting with the one at position
+		 * \a i_firstPoint within the box, as described in CoordinateGrid::for_each_point.
+		 * 
+		 * The positions of the grid points within the box follow from the index differences \a rangeStrides between neighbouring
+		 * grid points along each axis, while the coordinates and integration weights of the axis points within the box are
+		 * looked up in \a axisCoords and \a axisWeights.
+		 */
+		template <class Body>
+		void visit_points (const GridPointRange<Dim>& range, const IntegerArray<Dim>& rangeStrides, const std::array<std::vector<double>, Dim>& axisCoords, const std::array<std::vector<double>, Dim>& axisWeights, std::size_t i_firstPoint, std::size_t pointNumber, const Body& body) const;
+	};
+}
+
+#include "CoordinateGrid.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
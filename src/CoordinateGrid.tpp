@@ -0,0 +1,620 @@
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+template <std::size_t Dim>
+constexpr std::size_t MultiDimGrid::CoordinateGrid<Dim>::CornerNumber;
+
+template <std::size_t Dim>
+constexpr std::size_t MultiDimGrid::CoordinateGrid<Dim>::IterationChunkNumber;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+template <std::size_t Dim>
+MultiDimGrid::CoordinateGrid<Dim>::CoordinateGrid (const CoordinateAxisPointers<Dim>& coordAxisPointers) :
+	CoordAxes(copy_coordinate_axes(coordAxisPointers)),
+	IndexStrides(compute_index_strides(CoordAxes)),
+	CornerOffsets(compute_corner_offsets(CoordAxes, IndexStrides)),
+	GridPointNumber( IndexStrides[0] * CoordAxes[0]->point_number() )	// the 0-th index stride is given by the product of the numbers of points of all coordinate axes except for the 0-th
+{
+	static_assert(Dim != 0, "MultiDimGrid::CoordinateGrid Error: Number of dimensions is zero");
+}
+
+template <std::size_t Dim>
+MultiDimGrid::CoordinateGrid<Dim>::CoordinateGrid (const SharedCoordinateAxisPointers<Dim>& sharedCoordAxes) :
+	CoordAxes(sharedCoordAxes),
+	IndexStrides(compute_index_strides(CoordAxes)),
+	CornerOffsets(compute_corner_offsets(CoordAxes, IndexStrides)),
+	GridPointNumber( IndexStrides[0] * CoordAxes[0]->point_number() )	// the 0-th index stride is given by the product of the numbers of points of all coordinate axes except for the 0-th
+{
+	static_assert(Dim != 0, "MultiDimGrid::CoordinateGrid Error: Number of dimensions is zero");
+}
+
+template <std::size_t Dim>
+MultiDimGrid::CoordinateGrid<Dim>::CoordinateGrid (const std::vector<AxisDescription>& axisDescriptions) :
+	CoordAxes(create_coordinate_axes(axisDescriptions)),
+	IndexStrides(compute_index_strides(CoordAxes)),
+	CornerOffsets(compute_corner_offsets(CoordAxes, IndexStrides)),
+	GridPointNumber( IndexStrides[0] * CoordAxes[0]->point_number() )	// the 0-th index stride is given by the product of the numbers of points of all coordinate axes except for the 0-th
+{
+	static_assert(Dim != 0, "MultiDimGrid::CoordinateGrid Error: Number of dimensions is zero");
+}
+
+template <std::size_t Dim>
+MultiDimGrid::Coordinates<Dim> MultiDimGrid::CoordinateGrid<Dim>::coordinates (const GridPoint<Dim>& gridPoint) const
+{
+	Coordinates<Dim> coords;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const std::size_t axisPoint = gridPoint[i_axis];
+		
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
+		
+		check_axis_point(axisPoint, axis, "CoordinateGrid::coordinates");
+		
+		coords[i_axis] = axis->coordinate_unchecked(axisPoint);	// for each axis read off the coordinate of the corresponding axis point
+	}
+	
+	return coords;
+}
+
+template <std::size_t Dim>
+MultiDimGrid::Coordinates<Dim> MultiDimGrid::CoordinateGrid<Dim>::coordinates_unchecked (const GridPoint<Dim>& gridPoint) const
+{
+	Coordinates<Dim> coords;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const std::size_t axisPoint = gridPoint[i_axis];
+		
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
+		
+		coords[i_axis] = axis->coordinate_unchecked(axisPoint);	// for each axis read off the coordinate of the corresponding axis point
+	}
+	
+	return coords;
+}
+
+template <std::size_t Dim>
+MultiDimGrid::Coordinates<Dim> MultiDimGrid::CoordinateGrid<Dim>::coordinates_at_index (const std::size_t index) const
+{
+	check_index(index, "CoordinateGrid::coordinates_at_index");
+	
+	return coordinates_at_index_unchecked(index);
+}
+
+template <std::size_t Dim>
+MultiDimGrid::Coordinates<Dim> MultiDimGrid::CoordinateGrid<Dim>::coordinates_at_index_unchecked (const std::size_t index) const
+{
+	Coordinates<Dim> coords;
+	
+	std::size_t reducedIndex = index;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// if the index is divided by the outermost (i_axis=0) stride, the result is given by the value of the outermost axis point plus a rest that is smaller than one, but integer division in C++ omits this rest automatically; if one then subtracts the product of this axis point value and its stride to get an reduced index, this procedure can be repeated for the inner axes
+	{
+		const std::size_t stride = IndexStrides[i_axis];
+		
+		const std::size_t axisPoint = reducedIndex / stride;
+		
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
+		
+		coords[i_axis] = axis->coordinate_unchecked(axisPoint);	// read off the coordinate of the corresponding axis point
+		
+		reducedIndex -= axisPoint * stride;
+	}
+	
+	return coords;
+}
+
+template <std::size_t Dim>
+MultiDimGrid::DoubleArray<Dim> MultiDimGrid::CoordinateGrid<Dim>::integration_weights (const GridPoint<Dim>& gridPoint) const
+{
+	DoubleArray<Dim> weights;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const std::size_t axisPoint = gridPoint[i_axis];
+		
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
+		
+		check_axis_point(axisPoint, axis, "CoordinateGrid::integration_weight");
+		
+		weights[i_axis] = axis->integration_weight_unchecked(axisPoint);	// read off the integration weight of the corresponding axis point
+	}
+	
+	return weights;
+}
+
+template <std::size_t Dim>
+MultiDimGrid::DoubleArray<Dim> MultiDimGrid::CoordinateGrid<Dim>::integration_weights_unchecked (const GridPoint<Dim>& gridPoint) const
+{
+	DoubleArray<Dim> weights;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const std::size_t axisPoint = gridPoint[i_axis];
+		
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
+		
+		weights[i_axis] = axis->integration_weight_unchecked(axisPoint);	// read off the integration weight of the corresponding axis point
+	}
+	
+	return weights;
+}
+
+template <std::size_t Dim>
+MultiDimGrid::DoubleArray<Dim> MultiDimGrid::CoordinateGrid<Dim>::integration_weights_at_index (const std::size_t index) const
+{
+	check_index(index, "CoordinateGrid::integration_weight_at_index");
+	
+	return integration_weights_at_index_unchecked(index);
+}
+
+template <std::size_t Dim>
+MultiDimGrid::DoubleArray<Dim> MultiDimGrid::CoordinateGrid<Dim>::integration_weights_at_index_unchecked (const std::size_t index) const
+{
+	DoubleArray<Dim> weights;
+	
+	std::size_t reducedIndex = index;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// if the index is divided by the outermost (i_axis=0) stride, the result is given by the value of the outermost axis point plus a rest that is smaller than one, but integer division in C++ omits this rest automatically; if one then subtracts the product of this axis point value and its stride to get an reduced index, this procedure can be repeated for the inner axes
+	{
+		const std::size_t stride = IndexStrides[i_axis];
+		
+		const std::size_t axisPoint = reducedIndex / stride;
+		
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
+		
+		weights[i_axis] = axis->integration_weight_unchecked(axisPoint);	// read off the integration weight of the corresponding axis point
+		
+		reducedIndex -= axisPoint * stride;
+	}
+	
+	return weights;
+}
+
+template <std::size_t Dim>
+const MultiDimGrid::CoordinateAxis& MultiDimGrid::CoordinateGrid<Dim>::coordinate_axis (const std::size_t i_axis) const
+{
+	if ( i_axis >= Dim )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::CoordinateGrid::coordinate_axis Error: Axis not within range of grid" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+	
+	return *CoordAxes[i_axis];
+}
+
+template <std::size_t Dim>
+MultiDimGrid::IntegerArray<Dim> MultiDimGrid::CoordinateGrid<Dim>::index_strides () const
+{
+	return IndexStrides;
+}
+
+template <std::size_t Dim>
+double MultiDimGrid::CoordinateGrid<Dim>::point_number () const
+{
+	return GridPointNumber;
+}
+
+template <std::size_t Dim>
+std::vector<MultiDimGrid::AxisDescription> MultiDimGrid::CoordinateGrid<Dim>::axis_descriptions () const
+{
+	std::vector<AxisDescription> axisDescriptions;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		axisDescriptions.push_back( CoordAxes[i_axis]->description() );
+	}
+	
+	return axisDescriptions;
+}
+
+template <std::size_t Dim>
+const MultiDimGrid::SharedCoordinateAxisPointers<Dim>& MultiDimGrid::CoordinateGrid<Dim>::shared_coordinate_axes () const
+{
+	return CoordAxes;
+}
+
+template <std::size_t Dim>
+MultiDimGrid::GridPointRange<Dim> MultiDimGrid::CoordinateGrid<Dim>::grid_point_range () const
+{
+	GridPointRange<Dim> range;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		range.LowerGridPoint[i_axis] = 0;
+		range.UpperGridPoint[i_axis] = CoordAxes[i_axis]->point_number();
+	}
+	
+	return range;
+}
+
+template <std::size_t Dim>
+template <class Body>
+void MultiDimGrid::CoordinateGrid<Dim>::for_each_point (const Body& body, const ParallelSchedule schedule) const
+{
+	for_each_point(grid_point_range(), body, schedule);
+}
+
+template <std::size_t Dim>
+template <class Body>
+void MultiDimGrid::CoordinateGrid<Dim>::for_each_point (const GridPointRange<Dim>& range, const Body& body, const ParallelSchedule schedule) const
+{
+	check_grid_point_range(range, "CoordinateGrid::for_each_point");
+	
+	IntegerArray<Dim> rangeStrides;		// index differences between neighbouring grid points along each axis, if only the grid points within the box are enumerated
+	std::size_t rangePointNumber = 1;
+	
+	for ( std::size_t i_axis = Dim; i_axis-- > 0; )
+	{
+		rangeStrides[i_axis] = rangePointNumber;
+		
+		rangePointNumber *= range.UpperGridPoint[i_axis] - range.LowerGridPoint[i_axis];
+	}
+	
+	if ( rangePointNumber == 0 )
+	{
+		return;
+	}
+	
+	std::array<std::vector<double>, Dim> axisCoords;	// the coordinates and integration weights of the axis points within the box are obtained from the axes once in advance
+	std::array<std::vector<double>, Dim> axisWeights;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
+		
+		for ( std::size_t axisPoint = range.LowerGridPoint[i_axis]; axisPoint < range.UpperGridPoint[i_axis]; ++axisPoint )
+		{
+			axisCoords[i_axis].push_back( axis->coordinate_unchecked(axisPoint) );
+			axisWeights[i_axis].push_back( axis->integration_weight_unchecked(axisPoint) );
+		}
+	}
+	
+	const std::size_t chunkSize = (schedule == ParallelSchedule::Serial) ? rangePointNumber : ((rangePointNumber + IterationChunkNumber - 1) / IterationChunkNumber);
+	const std::size_t chunkNumber = (rangePointNumber + chunkSize - 1) / chunkSize;
+	
+	parallel_for(chunkNumber, schedule, [&] (const std::size_t i_chunk)
+	{
+		const std::size_t i_firstPoint = i_chunk * chunkSize;
+		const std::size_t chunkPointNumber = (rangePointNumber - i_firstPoint < chunkSize) ? (rangePointNumber - i_firstPoint) : chunkSize;
+		
+		visit_points(range, rangeStrides, axisCoords, axisWeights, i_firstPoint, chunkPointNumber, body);
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+template <std::size_t Dim>
+std::size_t MultiDimGrid::CoordinateGrid<Dim>::locate_cell (const Coordinates<Dim>& coords, DoubleArray<Dim>& interpolationWeights) const
+{
+	std::size_t cellIndex = 0;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// the cell and the weights are determined once per axis
+	{
+		cellIndex += locate_cell_axis_point(i_axis, coords[i_axis], interpolationWeights[i_axis]) * IndexStrides[i_axis];
+	}
+	
+	return cellIndex;
+}
+
+template <std::size_t Dim>
+std::size_t MultiDimGrid::CoordinateGrid<Dim>::locate_cell_axis_point (const std::size_t i_axis, const double coord, double& interpolationWeight) const
+{
+	const CoordinateAxis* axis = CoordAxes[i_axis].get();
+	
+	return cell_axis_point(axis->locate_unchecked(coord), axis->point_number(), interpolationWeight);	// the axis point and the weight are obtained from a single lookup
+}
+
+template <std::size_t Dim>
+std::size_t MultiDimGrid::CoordinateGrid<Dim>::cell_axis_point (const AxisLocation& location, const std::size_t axisPointNumber, double& interpolationWeight)
+{
+	const std::size_t lastAxisPoint = axisPointNumber - 1;
+	
+	if ( (location.LowerAxisPoint >= lastAxisPoint) && (lastAxisPoint > 0) )	// a coordinate at the upper limit of the axis is assigned to the last interval, so that the higher corners of its cell are still part of the grid
+	{
+		interpolationWeight = 1.0;
+		
+		return lastAxisPoint - 1;
+	}
+	
+	interpolationWeight = location.InterpolationWeight;
+	
+	return location.LowerAxisPoint;
+}
+
+template <std::size_t Dim>
+double MultiDimGrid::CoordinateGrid<Dim>::interpolate_corner_values (double* cornerValues, const DoubleArray<Dim>& interpolationWeights)
+{
+	std::size_t remainingCornerNumber = CornerNumber;
+	
+	for ( std::size_t i_bit = 0; i_bit < Dim; ++i_bit )	// perform the 1-dimensional interpolations axis by axis, starting with the innermost one, by combining pairs of corners that only differ along that axis; each step halves the number of remaining corners
+	{
+		const double interpolationWeight = interpolationWeights[Dim - 1 - i_bit];
+		
+		remainingCornerNumber /= 2;
+		
+		for ( std::size_t i_corner = 0; i_corner < remainingCornerNumber; ++i_corner )
+		{
+			cornerValues[i_corner] = cornerValues[2 * i_corner] * (1.0 - interpolationWeight) + cornerValues[2 * i_corner + 1] * interpolationWeight;
+		}
+	}
+	
+	return cornerValues[0];
+}
+
+template <std::size_t Dim>
+double MultiDimGrid::CoordinateGrid<Dim>::interpolate_corner_values (const double* const cornerValues, double* const halvedCornerValues, const DoubleArray<Dim>& interpolationWeights)
+{
+	std::size_t remainingCornerNumber = CornerNumber / 2;
+	
+	const double innermostInterpolationWeight = interpolationWeights[Dim - 1];
+	
+	for ( std::size_t i_corner = 0; i_corner < remainingCornerNumber; ++i_corner )	// the interpolation along the innermost axis reads the unchanged corner values, the ones along all other axes are carried out in place within the halved corner values
+	{
+		halvedCornerValues[i_corner] = cornerValues[2 * i_corner] * (1.0 - innermostInterpolationWeight) + cornerValues[2 * i_corner + 1] * innermostInterpolationWeight;
+	}
+	
+	for ( std::size_t i_bit = 1; i_bit < Dim; ++i_bit )
+	{
+		const double interpolationWeight = interpolationWeights[Dim - 1 - i_bit];
+		
+		remainingCornerNumber /= 2;
+		
+		for ( std::size_t i_corner = 0; i_corner < remainingCornerNumber; ++i_corner )
+		{
+			halvedCornerValues[i_corner] = halvedCornerValues[2 * i_corner] * (1.0 - interpolationWeight) + halvedCornerValues[2 * i_corner + 1] * interpolationWeight;
+		}
+	}
+	
+	return halvedCornerValues[0];
+}
+
+template <std::size_t Dim>
+std::vector<double> MultiDimGrid::CoordinateGrid<Dim>::axis_integration_weights (const std::size_t i_axis) const
+{
+	const CoordinateAxis* axis = CoordAxes[i_axis].get();
+	
+	std::vector<double> integrationWeights;
+	
+	for ( std::size_t i_axisPoint = 0; i_axisPoint < axis->point_number(); ++i_axisPoint )
+	{
+		integrationWeights.push_back( axis->integration_weight_unchecked(i_axisPoint) );
+	}
+	
+	return integrationWeights;
+}
+
+template <std::size_t Dim>
+std::vector<double> MultiDimGrid::CoordinateGrid<Dim>::axis_coordinates (const std::size_t i_axis) const
+{
+	const CoordinateAxis* axis = CoordAxes[i_axis].get();
+	
+	std::vector<double> coords;
+	
+	for ( std::size_t i_axisPoint = 0; i_axisPoint < axis->point_number(); ++i_axisPoint )
+	{
+		coords.push_back( axis->coordinate_unchecked(i_axisPoint) );
+	}
+	
+	return coords;
+}
+
+template <std::size_t Dim>
+void MultiDimGrid::CoordinateGrid<Dim>::check_axis_point (const std::size_t axisPoint, const CoordinateAxis* axis, const char* location) const
+{
+	if ( (axisPoint < 0) || (axisPoint >= axis->point_number()) )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::" + std::string(location) + " Error: Point not within range of grid" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+}
+
+template <std::size_t Dim>
+void MultiDimGrid::CoordinateGrid<Dim>::check_coordinate (const double coord, const CoordinateAxis* axis, const char* location) const
+{
+	if ( (coord < axis->lower_coordinate_limit()) || (coord > axis->upper_coordinate_limit()) )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::" + std::string(location) + " Coordinates not within range of grid" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+}
+
+template <std::size_t Dim>
+void MultiDimGrid::CoordinateGrid<Dim>::check_coordinates (const Coordinates<Dim>& coords, const char* location) const
+{
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		check_coordinate(coords[i_axis], CoordAxes[i_axis].get(), location);
+	}
+}
+
+template <std::size_t Dim>
+void MultiDimGrid::CoordinateGrid<Dim>::check_index (const std::size_t index, const char* location) const
+{
+	if ( index >= GridPointNumber )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::" + std::string(location) + " Index not within range of grid" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+}
+
+template <std::size_t Dim>
+void MultiDimGrid::CoordinateGrid<Dim>::check_grid_point_range (const GridPointRange<Dim>& range, const char* location) const
+{
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		if ( (range.LowerGridPoint[i_axis] > range.UpperGridPoint[i_axis]) || (range.UpperGridPoint[i_axis] > CoordAxes[i_axis]->point_number()) )
+		{
+			std::cout << std::endl
+					  << " MultiDimGrid::" + std::string(location) + " Range of grid points not within range of grid" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <std::size_t Dim>
+MultiDimGrid::SharedCoordinateAxisPointers<Dim> MultiDimGrid::CoordinateGrid<Dim>::copy_coordinate_axes (const MultiDimGrid::CoordinateAxisPointers<Dim>& coordAxisPointers) const
+{
+	SharedCoordinateAxisPointers<Dim> coordAxes;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// iterate through the different coordinate axes and copy them once using the 'CoordinateAxis::clone' method; afterwards, they are shared by all copies of this grid function
+	{
+		coordAxes[i_axis] = std::shared_ptr<const CoordinateAxis>( coordAxisPointers[i_axis]->clone() );
+	}
+	
+	return coordAxes;
+}
+
+template <std::size_t Dim>
+MultiDimGrid::SharedCoordinateAxisPointers<Dim> MultiDimGrid::CoordinateGrid<Dim>::create_coordinate_axes (const std::vector<AxisDescription>& axisDescriptions) const
+{
+	if ( axisDescriptions.size() != Dim )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::CoordinateGrid Error: Number of axis descriptions does not match number of dimensions" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+	
+	SharedCoordinateAxisPointers<Dim> coordAxes;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		coordAxes[i_axis] = std::shared_ptr<const CoordinateAxis>( create_coordinate_axis(axisDescriptions[i_axis]) );
+	}
+	
+	return coordAxes;
+}
+
+template <std::size_t Dim>
+MultiDimGrid::IntegerArray<Dim> MultiDimGrid::CoordinateGrid<Dim>::compute_index_strides (const MultiDimGrid::SharedCoordinateAxisPointers<Dim>& sharedCoordAxes) const
+{
+	IntegerArray<Dim> indexStrides;
+	
+	indexStrides[Dim-1] = 1;	// stride of the innermost coordinate in the nested 1-dimensional storage is '1'
+	
+	for ( std::size_t i_axis_reverse = 2; i_axis_reverse <= Dim; ++i_axis_reverse )	// iterate through the remaining coordinate axes in reverse order
+	{
+		const std::size_t i_axis = Dim - i_axis_reverse;
+		
+		indexStrides[i_axis] = indexStrides[i_axis + 1] * sharedCoordAxes[i_axis + 1]->point_number();	// the corresponding strides are found iteratively: the stride of any coordinate is given by the stride of the coordinate one nesting level deeper times the number of points of that cordinate's axis
+	}
+	
+	return indexStrides;
+}
+
+template <std::size_t Dim>
+MultiDimGrid::IntegerArray<MultiDimGrid::CoordinateGrid<Dim>::CornerNumber> MultiDimGrid::CoordinateGrid<Dim>::compute_corner_offsets (const MultiDimGrid::SharedCoordinateAxisPointers<Dim>& sharedCoordAxes, const MultiDimGrid::IntegerArray<Dim>& indexStrides) const
+{
+	IntegerArray<CornerNumber> cornerOffsets;
+	
+	for ( std::size_t i_corner = 0; i_corner < CornerNumber; ++i_corner )
+	{
+		std::size_t offset = 0;
+		
+		for ( std::size_t i_bit = 0; i_bit < Dim; ++i_bit )	// the j-th bit of the corner number states whether the corner lies at the higher axis point of the axis with index 'Dim-1-j'
+		{
+			const std::size_t i_axis = Dim - 1 - i_bit;
+			
+			if ( ((i_corner >> i_bit) & 1) && (sharedCoordAxes[i_axis]->point_number() > 1) )	// on a single-point axis the higher and lower axis points coincide
+			{
+				offset += indexStrides[i_axis];
+			}
+		}
+		
+		cornerOffsets[i_corner] = offset;
+	}
+	
+	return cornerOffsets;
+}
+
+template <std::size_t Dim>
+template <class Body>
+void MultiDimGrid::CoordinateGrid<Dim>::visit_points (const GridPointRange<Dim>& range, const IntegerArray<Dim>& rangeStrides, const std::array<std::vector<double>, Dim>& axisCoords, const std::array<std::vector<double>, Dim>& axisWeights, const std::size_t i_firstPoint, const std::size_t pointNumber, const Body& body) const
+{
+	GridPointVisit<Dim> visit;
+	
+	const GridPointVisit<Dim>& constVisit = visit;	// 'body' may not modify the visited grid point
+	
+	std::array<std::size_t, Dim + 1> partialIndices;	// partial sums of the index and partial products of the integration weights over the outermost axes, so that a change of the axis point along some axis only requires to update the sums and products from that axis inwards
+	std::array<double, Dim + 1> partialWeights;
+	
+	partialIndices[0] = 0;
+	partialWeights[0] = 1.0;
+	
+	const auto enter_axis_point = [&] (const std::size_t i_axis)	// updates the quantities depending on the axis point along the axis with index 'i_axis', given that they are up to date for all outer axes
+	{
+		const std::size_t i_rangeAxisPoint = visit.Point[i_axis] - range.LowerGridPoint[i_axis];
+		
+		visit.Coords[i_axis] = axisCoords[i_axis][i_rangeAxisPoint];
+		
+		partialIndices[i_axis + 1] = partialIndices[i_axis] + visit.Point[i_axis] * IndexStrides[i_axis];
+		partialWeights[i_axis + 1] = partialWeights[i_axis] * axisWeights[i_axis][i_rangeAxisPoint];
+	};
+	
+	std::size_t remainingPosition = i_firstPoint;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// only the first grid point is determined by integer divisions, in the same way as in 'coordinates_at_index_unchecked'
+	{
+		const std::size_t i_rangeAxisPoint = remainingPosition / rangeStrides[i_axis];
+		
+		remainingPosition -= i_rangeAxisPoint * rangeStrides[i_axis];
+		
+		visit.Point[i_axis] = range.LowerGridPoint[i_axis] + i_rangeAxisPoint;
+		
+		enter_axis_point(i_axis);
+	}
+	
+	for ( std::size_t i_point = 0; ; )
+	{
+		visit.Index = partialIndices[Dim];
+		visit.IntegrationWeight = partialWeights[Dim];
+		
+		body(constVisit);
+		
+		if ( ++i_point == pointNumber )
+		{
+			return;
+		}
+		
+		std::size_t i_axis = Dim - 1;
+		
+		while ( ++visit.Point[i_axis] == range.UpperGridPoint[i_axis] )	// advance like an odometer, i.e. an axis point running past the box is reset to its lower end and the axis point along the next outer axis is advanced instead; this never runs past the outermost axis, as the last grid point of the box ends the loop
+		{
+			visit.Point[i_axis] = range.LowerGridPoint[i_axis];
+			
+			--i_axis;
+		}
+		
+		for ( std::size_t i_changedAxis = i_axis; i_changedAxis < Dim; ++i_changedAxis )
+		{
+			enter_axis_point(i_changedAxis);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "FunctionValueBuffer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#include <sys/mman.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+std::shared_ptr<void> MultiDimGrid::allocate_function_value_storage (const std::size_t size, const StoragePolicy& policy)
+{
+	if ( (policy.Alignment == 0) || ((policy.Alignment & (policy.Alignment - 1)) != 0) )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::allocate_function_value_storage Error: Alignment is not a power of two" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+	
+	if ( policy.Pages == HugePages::None )
+	{
+		void* memory = nullptr;
+		
+		if ( posix_memalign(&memory, (policy.Alignment < sizeof(void*)) ? sizeof(void*) : policy.Alignment, size) != 0 )	// large allocations are mapped directly from the kernel, so their pages remain untouched
+		{
+			std::cout << std::endl
+					  << " MultiDimGrid::allocate_function_value_storage Error: Could not allocate memory" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+		}
+		
+		return std::shared_ptr<void>(memory, free);
+	}
+	
+	const std::size_t mappingSize = ((size > 0) ? (size + HugePageSize - 1) : HugePageSize) / HugePageSize * HugePageSize;	// mappings in huge pages consist of whole huge pages
+	
+	if ( policy.Pages == HugePages::Explicit )
+	{
+		void* const memory = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		
+		if ( memory == MAP_FAILED )
+		{
+			std::cout << std::endl
+					  << " MultiDimGrid::allocate_function_value_storage Error: Could not allocate memory in explicit huge pages" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+		}
+		
+		return std::shared_ptr<void>(memory, [mappingSize] (void* const mappedMemory) { munmap(mappedMemory, mappingSize); });
+	}
+	
+	void* const reservedMemory = mmap(nullptr, mappingSize + HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);	// transparent huge pages can only back memory aligned to a huge page, so one more huge page is reserved to align the mapping
+	
+	if ( reservedMemory == MAP_FAILED )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::allocate_function_value_storage Error: Could not allocate memory" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+	
+	const std::uintptr_t reservedAddress = reinterpret_cast<std::uintptr_t>(reservedMemory);
+	const std::uintptr_t alignedAddress = (reservedAddress + HugePageSize - 1) / HugePageSize * HugePageSize;
+	
+	if ( alignedAddress > reservedAddress )	// the reserved memory in front of and behind the aligned mapping is released again
+	{
+		munmap(reservedMemory, alignedAddress - reservedAddress);
+	}
+	
+	munmap(reinterpret_cast<void*>(alignedAddress + mappingSize), reservedAddress + HugePageSize - alignedAddress);
+	
+	void* const memory = reinterpret_cast<void*>(alignedAddress);
+	
+	madvise(memory, mappingSize, MADV_HUGEPAGE);	// only a hint, which is ignored if transparent huge pages are disabled
+	
+	return std::shared_ptr<void>(memory, [mappingSize] (void* const mappedMemory) { munmap(mappedMemory, mappingSize); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
\ No newline at end of file
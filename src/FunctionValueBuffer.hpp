@@ -0,0 +1,226 @@
+#ifndef MULTIDIMGRID_FUNCTION_VALUE_BUFFER_H
+#define MULTIDIMGRID_FUNCTION_VALUE_BUFFER_H
+
+#include "Parallelization.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace MultiDimGrid
+{
+	/**
+	 * Kinds of memory pages in which the function values owned by a FunctionValueBuffer are allocated.
+	 * 
+	 * Huge pages reduce the number of TLB misses when accessing huge tables at random positions. HugePages::Transparent
+	 * aligns the allocation to MultiDimGrid::HugePageSize and advises the kernel to back it by transparent huge pages,
+	 * which it does if they are enabled and available. HugePages::Explicit allocates the memory from the pool of huge
+	 * pages reserved by the system administrator, and fails if not enough of them are left.
+	 */
+	enum class HugePages
+	{
+		None,
+		Transparent,
+		Explicit
+	};
+	
+	/**
+	 * Policy according to which the function values owned by a FunctionValueBuffer are allocated.
+	 */
+	struct StoragePolicy
+	{
+		/**
+		 * Alignment of the first function value in bytes, which has to be a power of two. Allocations in huge pages are
+		 * always aligned to MultiDimGrid::HugePageSize.
+		 */
+		std::size_t Alignment;
+		
+		/**
+		 * Kind of memory pages.
+		 */
+		HugePages Pages;
+	};
+	
+	/**
+	 * Storage policy used unless specified otherwise, which aligns the function values to a cache line.
+	 */
+	constexpr StoragePolicy DefaultStoragePolicy = {64, HugePages::None};
+	
+	/**
+	 * Size of a huge page in bytes.
+	 */
+	constexpr std::size_t HugePageSize = 2097152;
+	
+	/**
+	 * Allocates at least \a size bytes of memory according to the storage policy \a policy and returns its owner, which
+	 * releases it when destroyed. The memory is not initialized, so its pages are only placed in physical memory by the
+	 * first write to them, on the NUMA node of the writing thread. If the allocation fails, an error message is written
+	 * to the standard output and the program is terminated.
+	 */
+	std::shared_ptr<void> allocate_function_value_storage (std::size_t size, const StoragePolicy& policy);
+	
+	/**
+	 * \brief Class holding the function values of a GridFunction.
+	 * 
+	 * The values are either owned by the buffer itself or reside in some external memory, e.g. a memory-mapped file, that
+	 * is kept alive by a \c std::shared_ptr to an arbitrary owner object for as long as the buffer refers to it.
+	 * 
+	 * Copying a buffer always creates an owned copy of the values, such that the copy can be modified independently of
+	 * the original, even if the original values are read-only. Moving a buffer transfers the values without copying them.
+	 * 
+	 * Owned values are allocated according to a MultiDimGrid::StoragePolicy, which is kept by copies of the buffer.
+	 * 
+	 * The values are of type \a Value.
+	 */
+	template <class Value>
+	class FunctionValueBuffer
+	{
+	public:
+		/**
+		 * Constructor instantiating a buffer owning \a number values, which are all set to \a value.
+		 */
+		explicit FunctionValueBuffer (std::size_t number = 0, Value value = Value());
+		
+		/**
+		 * Constructor instantiating a buffer owning \a number uninitialized values, which are allocated according to
+		 * the storage policy \a policy.
+		 * 
+		 * As the memory pages are placed on the NUMA nodes of the threads that first write to them, the values should
+		 * be initialized in parallel, using the same distribution among threads as the work later performed on them.
+		 */
+		FunctionValueBuffer (std::size_t number, const StoragePolicy& policy);
+		
+		/**
+		 * Constructor instantiating a buffer owning a copy of the values \a values, which is made as described for
+		 * FunctionValueBuffer::copy_values.
+		 */
+		FunctionValueBuffer (const std::vector<Value>& values);
+		
+		/**
+		 * Constructor instantiating a buffer referring to the \a number external values starting at \a externalValues,
+		 * without copying them. The memory containing them is kept alive by \a externalOwner for as long as the buffer
+		 * refers to it. If \a isReadOnly is \c true, the external memory is protected against writing.
+		 */
+		FunctionValueBuffer (Value* externalValues, std::size_t number, std::shared_ptr<void> externalOwner, bool isReadOnly = false);
+		
+		/**
+		 * Copy-constructor instantiating a buffer owning a copy of the values of the buffer \a otherBuffer, which is made
+		 * as described for FunctionValueBuffer::copy_values.
+		 */
+		FunctionValueBuffer (const FunctionValueBuffer& otherBuffer);
+		
+		/**
+		 * Move-constructor taking over the values of the buffer \a otherBuffer without copying them. \a otherBuffer is
+		 * left empty.
+		 */
+		FunctionValueBuffer (FunctionValueBuffer&& otherBuffer) noexcept;
+		
+		/**
+		 * Assignment operator replacing the values of this buffer by an owned copy of the values of the buffer \a otherBuffer.
+		 */
+		FunctionValueBuffer& operator= (const FunctionValueBuffer& otherBuffer);
+		
+		/**
+		 * Move-assignment operator replacing the values of this buffer by the ones of the buffer \a otherBuffer without
+		 * copying them. \a otherBuffer is left empty.
+		 */
+		FunctionValueBuffer& operator= (FunctionValueBuffer&& otherBuffer) noexcept;
+		
+		/**
+		 * Returns a reference to the value with index \a index.
+		 */
+		Value& operator[] (std::size_t index);
+		
+		/**
+		 * Returns a constant reference to the value with index \a index.
+		 */
+		const Value& operator[] (std::size_t index) const;
+		
+		/**
+		 * Returns a pointer to the first value.
+		 */
+		Value* data ();
+		
+		/**
+		 * Returns a pointer to the first value.
+		 */
+		const Value* data () const;
+		
+		/**
+		 * Returns the number of values.
+		 */
+		std::size_t size () const;
+		
+		/**
+		 * Returns whether the values reside in external memory instead of being owned by the buffer.
+		 */
+		bool is_external () const;
+		
+		/**
+		 * Returns whether the values reside in external memory that is protected against writing, in which case writing
+		 * to them terminates the program with a segmentation fault.
+		 */
+		bool is_read_only () const;
+		
+		/**
+		 * Returns the storage policy according to which owned values are allocated.
+		 */
+		StoragePolicy storage_policy () const;
+	
+	private:
+		/**
+		 * The values are placed in uninitialized memory, which requires them to be trivially copyable.
+		 */
+		static_assert(std::is_trivially_copyable<Value>::value, "MultiDimGrid::FunctionValueBuffer Error: Value type is not trivially copyable");
+		
+		/**
+		 * Minimum size in bytes of values that are copied in parallel, which spans a few memory pages. Smaller copies
+		 * are not worth the overhead of an OpenMP parallel region and are made serially.
+		 */
+		static constexpr std::size_t ParallelCopySize = 16384;
+		
+		/**
+		 * Storage policy according to which owned values are allocated.
+		 */
+		StoragePolicy Policy;
+		
+		/**
+		 * Owner of the memory containing the values, which is either allocated by the buffer itself or external memory.
+		 */
+		std::shared_ptr<void> Storage;
+		
+		/**
+		 * Whether the values reside in external memory.
+		 */
+		bool IsExternal;
+		
+		/**
+		 * Whether the values reside in external memory that is protected against writing.
+		 */
+		bool IsReadOnly;
+		
+		/**
+		 * Pointer to the first value.
+		 */
+		Value* Values;
+		
+		/**
+		 * Number of values.
+		 */
+		std::size_t Number;
+		
+		/**
+		 * Copies the FunctionValueBuffer::Number values starting at \a values to the owned values. The copying is the
+		 * first write to their memory pages. If the values span at least FunctionValueBuffer::ParallelCopySize bytes, it
+		 * is distributed among OpenMP threads according to ParallelSchedule::Static, so the pages are spread over the NUMA
+		 * nodes of all threads in the same way as by a construction with this schedule. Otherwise the values are copied
+		 * serially.
+		 */
+		void copy_values (const Value* values);
+	};
+}
+
+#include "FunctionValueBuffer.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
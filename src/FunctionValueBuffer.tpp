@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+template <class Value>
+constexpr std::size_t MultiDimGrid::FunctionValueBuffer<Value>::ParallelCopySize;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+template <class Value>
+MultiDimGrid::FunctionValueBuffer<Value>::FunctionValueBuffer (const std::size_t number, const Value value) :
+	FunctionValueBuffer(number, DefaultStoragePolicy)
+{
+	std::uninitialized_fill_n(Values, Number, value);
+}
+
+template <class Value>
+MultiDimGrid::FunctionValueBuffer<Value>::FunctionValueBuffer (const std::size_t number, const StoragePolicy& policy) :
+	Policy(policy),
+	Storage(allocate_function_value_storage(number * sizeof(Value), policy)),
+	IsExternal(false),
+	IsReadOnly(false),
+	Values(static_cast<Value*>(Storage.get())),
+	Number(number)
+{}
+
+template <class Value>
+MultiDimGrid::FunctionValueBuffer<Value>::FunctionValueBuffer (const std::vector<Value>& values) :
+	FunctionValueBuffer(values.size(), DefaultStoragePolicy)
+{
+	copy_values(values.data());
+}
+
+template <class Value>
+MultiDimGrid::FunctionValueBuffer<Value>::FunctionValueBuffer (Value* const externalValues, const std::size_t number, std::shared_ptr<void> externalOwner, const bool isReadOnly) :
+	Policy(DefaultStoragePolicy),
+	Storage(std::move(externalOwner)),
+	IsExternal(true),
+	IsReadOnly(isReadOnly),
+	Values(externalValues),
+	Number(number)
+{}
+
+template <class Value>
+MultiDimGrid::FunctionValueBuffer<Value>::FunctionValueBuffer (const FunctionValueBuffer& otherBuffer) :
+	FunctionValueBuffer(otherBuffer.Number, otherBuffer.Policy)	// external values are copied as well, such that the copy never modifies the external memory
+{
+	copy_values(otherBuffer.Values);
+}
+
+template <class Value>
+MultiDimGrid::FunctionValueBuffer<Value>::FunctionValueBuffer (FunctionValueBuffer&& otherBuffer) noexcept :
+	Policy(otherBuffer.Policy),
+	Storage(std::move(otherBuffer.Storage)),
+	IsExternal(otherBuffer.IsExternal),
+	IsReadOnly(otherBuffer.IsReadOnly),
+	Values(otherBuffer.Values),
+	Number(otherBuffer.Number)
+{
+	otherBuffer.IsExternal = false;
+	otherBuffer.IsReadOnly = false;
+	otherBuffer.Values = nullptr;
+	otherBuffer.Number = 0;
+}
+
+template <class Value>
+MultiDimGrid::FunctionValueBuffer<Value>& MultiDimGrid::FunctionValueBuffer<Value>::operator= (const FunctionValueBuffer& otherBuffer)
+{
+	if ( this != &otherBuffer )
+	{
+		*this = FunctionValueBuffer(otherBuffer);
+	}
+	
+	return *this;
+}
+
+template <class Value>
+MultiDimGrid::FunctionValueBuffer<Value>& MultiDimGrid::FunctionValueBuffer<Value>::operator= (FunctionValueBuffer&& otherBuffer) noexcept
+{
+	if ( this != &otherBuffer )
+	{
+		Policy = otherBuffer.Policy;
+		Storage = std::move(otherBuffer.Storage);
+		IsExternal = otherBuffer.IsExternal;
+		IsReadOnly = otherBuffer.IsReadOnly;
+		Values = otherBuffer.Values;
+		Number = otherBuffer.Number;
+		
+		otherBuffer.IsExternal = false;
+		otherBuffer.IsReadOnly = false;
+		otherBuffer.Values = nullptr;
+		otherBuffer.Number = 0;
+	}
+	
+	return *this;
+}
+
+template <class Value>
+Value& MultiDimGrid::FunctionValueBuffer<Value>::operator[] (const std::size_t index)
+{
+	return Values[index];
+}
+
+template <class Value>
+const Value& MultiDimGrid::FunctionValueBuffer<Value>::operator[] (const std::size_t index) const
+{
+	return Values[index];
+}
+
+template <class Value>
+Value* MultiDimGrid::FunctionValueBuffer<Value>::data ()
+{
+	return Values;
+}
+
+template <class Value>
+const Value* MultiDimGrid::FunctionValueBuffer<Value>::data () const
+{
+	return Values;
+}
+
+template <class Value>
+std::size_t MultiDimGrid::FunctionValueBuffer<Value>::size () const
+{
+	return Number;
+}
+
+template <class Value>
+bool MultiDimGrid::FunctionValueBuffer<Value>::is_external () const
+{
+	return IsExternal;
+}
+
+template <class Value>
+bool MultiDimGrid::FunctionValueBuffer<Value>::is_read_only () const
+{
+	return IsReadOnly;
+}
+
+template <class Value>
+MultiDimGrid::StoragePolicy MultiDimGrid::FunctionValueBuffer<Value>::storage_policy () const
+{
+	return Policy;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <class Value>
+void MultiDimGrid::FunctionValueBuffer<Value>::copy_values (const Value* const values)
+{
+	if ( Number * sizeof(Value) < ParallelCopySize )
+	{
+		std::copy(values, values + Number, Values);	// the values are trivially copyable, so assigning them to uninitialized memory is sufficient
+		return;
+	}
+	
+	parallel_for(Number, ParallelSchedule::Static, [this, values] (const std::size_t index)
+	{
+		Values[index] = values[index];
+	});
+}
\ No newline at end of file
@@ -2,45 +2,103 @@
 #define MULTIDIMGRID_GRID_FUNCTION_H
 
 #include "CoordinateAxis.hpp"
+#include "CoordinateGrid.hpp"
+#include "FunctionValueBuffer.hpp"
+#include "GridFunctionFile.hpp"
+#include "HalfFloat.hpp"
+#include "Instrumentation.hpp"
+#include "Parallelization.hpp"
 
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace MultiDimGrid
 {
 	/**
-	 * Arrays of integer values of length \a Length are implemented as \c std::size_t \c std::arrays.
+	 * Batches of coordinates can alternatively be specified in a structure-of-arrays form as a \c double pointer \c std::array
+	 * of length \a Dim, with each element pointing to an array containing the coordinates along one of the axes.
 	 */
-	template <std::size_t Length>
-	using IntegerArray = std::array<std::size_t, Length>;
+	template <std::size_t Dim>
+	using CoordinateArrays = std::array<const double*, Dim>;
 	
 	/**
-	 * Arrays of real values of length \a Length are implemented as \c double \c std::arrays.
+	 * The interpolated function value and its gradient at some coordinates are returned together as a MultiDimGrid::ValueAndGradient<\a Dim>.
 	 */
-	template <std::size_t Length>
-	using DoubleArray = std::array<double, Length>;
+	template <std::size_t Dim>
+	struct ValueAndGradient
+	{
+		/**
+		 * Interpolated function value.
+		 */
+		double Value;
+		
+		/**
+		 * Derivatives of the interpolated function with respect to the coordinates along each axis.
+		 */
+		DoubleArray<Dim> Gradient;
+	};
 	
 	/**
-	 * A grid point is expected to be specified as a MultiDimGrid::IntegerArray<\a Dim>.
+	 * Memory layouts of the function values of a GridFunction.
+	 * 
+	 * In the StorageLayout::RowMajor layout the function values are stored in the nested fashion described in GridFunction::FunctionValues,
+	 * so neighbouring grid points along all but the innermost axis are far apart in memory. In the StorageLayout::Tiled
+	 * layout the grid is split into tiles of equal numbers of axis points along each axis, which are as large as fits
+	 * into a memory page, and the function values are stored tile by tile, each tile in the nested fashion. The corners
+	 * of most grid cells then lie within the same tile, which reduces the number of cache lines and memory pages touched
+	 * by an interpolation at random coordinates. As a tile spans at least two axis points along each axis, it exceeds
+	 * a memory page from 10 dimensions on for \c double values, 11 for \c float and 12 for MultiDimGrid::HalfFloat.
 	 */
-	template <std::size_t Dim>
-	using GridPoint = IntegerArray<Dim>;
+	enum class StorageLayout
+	{
+		RowMajor,
+		Tiled
+	};
 	
 	/**
-	 * Coordinates are expected to be specified as a MultiDimGrid::DoubleArray<\a Dim>.
+	 * Orders in which GridFunction::interpolate_many processes the coordinates it is given.
+	 * 
+	 * With QueryOrder::Given the coordinates are interpolated in the order in which they are stored. With QueryOrder::CellSorted
+	 * they are first sorted into buckets by the storage position of the lowest corner of the grid cell containing them,
+	 * interpolated bucket by bucket, and the interpolated values are scattered back to the given order. The function
+	 * values are then swept through in a single pass in storage order, so that every cache line and memory page of them
+	 * is loaded at most about once, at the cost of locating every coordinate twice and of copying the coordinates and
+	 * values. It can only pay off for grid functions much larger than the caches and numbers of coordinates comparable
+	 * to the number of grid points, and even then only if the memory latency outweighs these costs, which the benchmark
+	 * \c bench/bench_query_order.cpp measures.
 	 */
-	template <std::size_t Dim>
-	using Coordinates = DoubleArray<Dim>;
+	enum class QueryOrder
+	{
+		Given,
+		CellSorted
+	};
 	
 	/**
-	 * The coordinate axes of a grid are expected to be specified as a CoordinateAxis pointer \c std::array of length
-	 * \a Dim.
+	 * Estimate of the interpolation error of a GridFunction obtained by comparing it with a refined version of it, as
+	 * returned by GridFunction::refinement_error_estimate.
 	 */
 	template <std::size_t Dim>
-	using CoordinateAxisPointers = std::array<const CoordinateAxis*, Dim>;
+	struct RefinementErrorEstimate
+	{
+		/**
+		 * Maximum absolute difference between the function values of the refined grid function and the interpolation
+		 * of the coarse one at all grid points of the refined grid.
+		 */
+		double MaximumError;
+		
+		/**
+		 * Maximum absolute differences at the grid points of the refined grid that only differ from grid points of the
+		 * coarse grid along a single axis, for each axis. These indicate along which axes a further refinement is needed
+		 * most.
+		 */
+		DoubleArray<Dim> AxisMaximumErrors;
+	};
 	
 	/**
 	 * Functions that shall be discretized into a GridFunction are expected to be of this form: They depend on a reference
@@ -52,6 +110,17 @@ namespace MultiDimGrid
 	template <std::size_t Dim>
 	using Function = std::function<double(const Coordinates<Dim>& coords)>;
 	
+	/**
+	 * Functions that shall be discretized into a GridFunction batch by batch are expected to be of this form: They are
+	 * given a batch of \a number coordinates in structure-of-arrays form as MultiDimGrid::CoordinateArrays<\a Dim>
+	 * \a coordArrays, i.e. the coordinate along the axis with index i_axis of the i-th element of the batch is given
+	 * by coordArrays[i_axis][i], and write the \a number function values to the array \a values.
+	 * 
+	 * Any callable of this form can be passed to a GridFunction directly, without wrapping it in a \c std::function.
+	 */
+	template <std::size_t Dim>
+	using BatchFunction = std::function<void(const CoordinateArrays<Dim>& coordArrays, double* values, std::size_t number)>;
+	
 	/**
 	 * Pointers to member functions that shall be discretized into a GridFunction are expected to be of this form: They
 	 * point to a method of some class \a Class which depends on a reference to some MultiDimGrid::Coordinates<\a Dim>
@@ -68,41 +137,103 @@ namespace MultiDimGrid
 	template <std::size_t Dim, class Class>
 	using ConstMemberFunctionPointer = double(Class::*)(const Coordinates<Dim>& coords) const;
 	
+	template <std::size_t Dim, class Value>
+	class InterpolationCursor;
+	
+	template <class... Axes>
+	class StaticGridFunction;
+	
+	template <std::size_t Dim, std::size_t FieldNumber, class Value>
+	class MultiFieldGridFunction;
+	
+	template <std::size_t Dim, class Value>
+	class LazyGridFunction;
+	
 	/**
 	 * \brief Class providing a discrete function defined on a multi-dimensional coordinate grid. 
 	 *
 	 * The grid is spanned up by an arbitrary number of coordinate axes with each axis having a custom range and spacing.
 	 * It allows to read and modify the function value at each grid point individually and also is able to perform an interpolation
 	 * of the discrete function values that is multi-linear in the coordinate spacings for any coordinates within the range
-	 * of the grid. Furthermore, it allows to extract the coordinates and integration weights of each grid point.
+	 * of the grid. Furthermore, it allows to extract the coordinates and integration weights of each grid point, which
+	 * is provided by its base class CoordinateGrid.
+	 * 
+	 * The function values are stored as \a Value, which can be \c double, \c float or MultiDimGrid::HalfFloat. A lower
+	 * storage precision reduces the memory footprint and the memory bandwidth needed for interpolations, which is what
+	 * limits the speed of lookups in large grids. Independently of \a Value, functions to be discretized return \c double,
+	 * and interpolations and integrations are always carried out in \c double precision.
 	 * 
 	 * Author: Robert Lilow (2016)
 	 */
-	template <std::size_t Dim>
-	class GridFunction
+	template <std::size_t Dim, class Value = double>
+	class GridFunction : public CoordinateGrid<Dim>
 	{
 	public:
 		/**
 		 * Constructor instantiating a discrete function defined on a grid spanned up by several coordinate axes pointed
 		 * to by the \a coordAxisPointers with constant function value \a funcValue.
 		 */
-		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, double funcValue);
+		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, Value funcValue);
 		
 		/**
 		 * Constructor instantiating a discrete function defined on a grid spanned up by several coordinate axes pointed
 		 * to by the \a coordAxisPointers with the function value of each grid point set to the value of the MultiDimGrid::Function
 		 * \a func at the coordinates of this grid point.
+		 * 
+		 * The evaluations of \a func are distributed among OpenMP threads according to \a schedule, so \a func has
+		 * to be safe to call concurrently unless \a schedule is ParallelSchedule::Serial.
+		 * 
+		 * The function values are allocated according to the storage policy \a policy. They are first written by the
+		 * evaluations, so each memory page is placed on the NUMA node of the thread evaluating \a func at its grid points.
 		 */
-		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const Function<Dim>& func);
+		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const Function<Dim>& func, ParallelSchedule schedule = ParallelSchedule::Serial, const StoragePolicy& policy = DefaultStoragePolicy);
+		
+		/**
+		 * Constructor instantiating a discrete function defined on a grid spanned up by several coordinate axes pointed
+		 * to by the \a coordAxisPointers with the function value of each grid point set to the value of the callable
+		 * \a func at the coordinates of this grid point. \a func has to be callable like a MultiDimGrid::Function<\a Dim>.
+		 * 
+		 * In contrast to the constructor taking a MultiDimGrid::Function, \a func is called directly instead of through a
+		 * \c std::function, which allows the compiler to inline it.
+		 * 
+		 * The evaluations of \a func are distributed among OpenMP threads according to \a schedule, so \a func has
+		 * to be safe to call concurrently unless \a schedule is ParallelSchedule::Serial. The function values are allocated
+		 * and placed in memory as described for the constructor taking a MultiDimGrid::Function.
+		 */
+		template <class Callable, typename std::enable_if<std::is_convertible<decltype(std::declval<const Callable&>()(std::declval<const Coordinates<Dim>&>())), double>::value, int>::type = 0>
+		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const Callable& func, ParallelSchedule schedule = ParallelSchedule::Serial, const StoragePolicy& policy = DefaultStoragePolicy);
+		
+		/**
+		 * Constructor instantiating a discrete function defined on a grid spanned up by several coordinate axes pointed
+		 * to by the \a coordAxisPointers with the function values set to the values of the callable \a batchFunc at the
+		 * coordinates of the grid points. \a batchFunc has to be callable like a MultiDimGrid::BatchFunction<\a Dim>.
+		 * 
+		 * \a batchFunc is called for batches of at most GridFunction::BatchEvaluationSize grid points with consecutive
+		 * indices, which consist either of whole rows of grid points along the innermost axis or of a contiguous part of
+		 * a single row. Within each batch, the coordinates along the innermost axis thus increase along runs of consecutive
+		 * elements, while the other coordinates stay constant, so \a batchFunc can evaluate the batch using SIMD instructions
+		 * or a batched solver of its own.
+		 * 
+		 * The batches are distributed among OpenMP threads according to \a schedule, so \a batchFunc has to be safe to call
+		 * concurrently unless \a schedule is ParallelSchedule::Serial. The function values are allocated according to the
+		 * storage policy \a policy, and each memory page is placed on the NUMA node of the thread evaluating the batches
+		 * that it contains.
+		 */
+		template <class BatchCallable, typename std::enable_if<std::is_void<decltype(std::declval<const BatchCallable&>()(std::declval<const CoordinateArrays<Dim>&>(), std::declval<double*>(), std::declval<std::size_t>()))>::value, long>::type = 0>
+		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const BatchCallable& batchFunc, ParallelSchedule schedule = ParallelSchedule::Serial, const StoragePolicy& policy = DefaultStoragePolicy);
 		
 		/**
 		 * Constructor instantiating a discrete function defined on a grid spanned up by several coordinate axes pointed
 		 * to by the \a coordAxisPointers with the function value of each grid point set to the value of some member
 		 * function at the coordinates of this grid point. The member function is characterized by a MultiDimGrid::MemberFunctionPointer
 		 * \a memberFuncPointer as well as an instance \a object of its host class \a Class.
+		 * 
+		 * The evaluations of the member function are distributed among OpenMP threads according to \a schedule, so
+		 * it has to be safe to call concurrently on \a object unless \a schedule is ParallelSchedule::Serial. The function
+		 * values are allocated and placed in memory as described for the constructor taking a MultiDimGrid::Function.
 		 */
 		template <class Class>
-		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const MemberFunctionPointer<Dim, Class> memberFuncPointer, Class& object);
+		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const MemberFunctionPointer<Dim, Class> memberFuncPointer, Class& object, ParallelSchedule schedule = ParallelSchedule::Serial, const StoragePolicy& policy = DefaultStoragePolicy);
 		
 		/**
 		 * Constructor instantiating a discrete function defined on a grid spanned up by several coordinate axes pointed
@@ -110,69 +241,46 @@ namespace MultiDimGrid
 		 * member function at the coordinates of this grid point. The \c const member function is characterized by a
 		 * MultiDimGrid::ConstMemberFunctionPointer \a constMemberFuncPointer as well as a \c const instance \a constObject
 		 * of its host class \a Class.
-		 */
-		template <class Class>
-		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const ConstMemberFunctionPointer<Dim, Class> constMemberFuncPointer, const Class& constObject);
-		
-		/**
-		 * Copy-constructor taking care of properly copying the coordinate axes pointed to by the elements of
-		 * GridFunction::CoordAxes from the GridFunction \a otherGridFunction.
-		 */
-		GridFunction (const GridFunction& otherGridFunction);
-		
-		/**
-		 * Returns the coordinates of the grid point \a gridPoint.
-		 */
-		Coordinates<Dim> coordinates (const GridPoint<Dim>& gridPoint) const;
-		
-		/**
-		 * Returns the coordinates of the grid point \a gridPoint.
 		 * 
-		 * In contrast to GridFunction::coordinates, this method does not check if \a gridPoint is within the range of the
-		 * grid. It is thus slightly faster, but unsafe!
+		 * The evaluations of the \c const member function are distributed among OpenMP threads according to \a schedule,
+		 * so it has to be safe to call concurrently on \a constObject unless \a schedule is ParallelSchedule::Serial. The
+		 * function values are allocated and placed in memory as described for the constructor taking a MultiDimGrid::Function.
 		 */
-		Coordinates<Dim> coordinates_unchecked (const GridPoint<Dim>& gridPoint) const;
+		template <class Class>
+		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const ConstMemberFunctionPointer<Dim, Class> constMemberFuncPointer, const Class& constObject, ParallelSchedule schedule = ParallelSchedule::Serial, const StoragePolicy& policy = DefaultStoragePolicy);
 		
 		/**
-		 * Returns the coordinates of the grid point with index \a index.
+		 * Constructor instantiating a discrete function defined on a grid spanned up by several coordinate axes pointed
+		 * to by the \a coordAxisPointers with the function values given by \a funcValues. These have to be stored in the
+		 * nested fashion described in GridFunction::FunctionValues.
 		 */
-		Coordinates<Dim> coordinates_at_index (std::size_t index) const;
+		GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const std::vector<Value>& funcValues);
 		
 		/**
-		 * Returns the coordinates of the grid point with index \a index.
+		 * Constructor instantiating a discrete function from the grid function file with name \a fileName, written by
+		 * GridFunction::write_to_file.
 		 * 
-		 * In contrast to GridFunction::coordinates_at_index, this method does not check if \a index is within the range
-		 * of the grid. It is thus slightly faster, but unsafe!
-		 */
-		Coordinates<Dim> coordinates_at_index_unchecked (std::size_t index) const;
-		
-		/**
-		 * Returns the integration weights corresponding to the individual coordinate axes at the grid point \a gridPoint.
+		 * The file is mapped into memory and the function values are used in place without copying them, such that
+		 * loading even a huge grid function only requires the memory pages actually accessed to be read, possibly directly
+		 * from the page cache. Modifying function values only affects private copies of the modified memory pages and never
+		 * changes the file. Copies of this grid function own copies of the function values.
 		 */
-		DoubleArray<Dim> integration_weights (const GridPoint<Dim>& gridPoint) const;
+		explicit GridFunction (const std::string& fileName);
 		
 		/**
-		 * Returns the integration weights corresponding to the individual coordinate axes at the grid point \a gridPoint.
+		 * Copy-constructor instantiating a copy of the GridFunction \a otherGridFunction.
 		 * 
-		 * In contrast to GridFunction::integration_weight, this method does not check if \a gridPoint is within the range
-		 * of the grid. It is thus slightly faster, but unsafe!
+		 * Only the function values are copied, while the immutable coordinate axes pointed to by the elements of
+		 * GridFunction::CoordAxes are shared with \a otherGridFunction.
 		 */
-		DoubleArray<Dim> integration_weights_unchecked (const GridPoint<Dim>& gridPoint) const;
+		GridFunction (const GridFunction& otherGridFunction) = default;
 		
 		/**
-		 * Returns the integration weights corresponding to the individual coordinate axes at the grid point with index
-		 * \a index.
+		 * Move-constructor taking over the coordinate axes and function values of the GridFunction \a otherGridFunction
+		 * without copying them. \a otherGridFunction is left without a grid and must not be used anymore, except for
+		 * being assigned to or destroyed.
 		 */
-		DoubleArray<Dim> integration_weights_at_index (std::size_t index) const;
-		
-		/**
-		 * Returns the integration weights corresponding to the individual coordinate axes at the grid point with index
-		 * \a index.
-		 * 
-		 * In contrast to GridFunction::integration_weight_at_index, this method does not check if \a index is within the
-		 * range of the grid. It is thus slightly faster, but unsafe!
-		 */
-		DoubleArray<Dim> integration_weights_at_index_unchecked (std::size_t index) const;
+		GridFunction (GridFunction&& otherGridFunction) noexcept = default;
 		
 		/**
 		 * Gives access to the function value at the grid point \a gridPoint by returning a \c reference to it.
@@ -180,7 +288,7 @@ namespace MultiDimGrid
 		 * Contrary to GridFunction::value(const GridPoint<Dim>& gridPoint) const, this allows to modify the function value
 		 * and will be called if the instance of GridFunction is not \c const-qualified.
 		 */
-		double& value (const GridPoint<Dim>& gridPoint);
+		Value& value (const GridPoint<Dim>& gridPoint);
 		
 		/**
 		 * Gives access to the function value at the grid point \a gridPoint by returning a \c const_reference to it.
@@ -188,7 +296,7 @@ namespace MultiDimGrid
 		 * Contrary to GridFunction::value(const GridPoint<Dim>& gridPoint), this does not allow to modify the function
 		 * value and will be called if the instance of GridFunction is \c const-qualified.
 		 */
-		const double& value (const GridPoint<Dim>& gridPoint) const;
+		const Value& value (const GridPoint<Dim>& gridPoint) const;
 		
 		/**
 		 * Gives access to the function value at the grid point \a gridPoint by returning a \c reference to it.
@@ -199,7 +307,7 @@ namespace MultiDimGrid
 		 * In contrast to GridFunction::value(const GridPoint<Dim>& gridPoint), this method does not check if \a gridPoint
 		 * is within the range of the grid. It is thus slightly faster, but unsafe!
 		 */
-		double& value_unchecked (const GridPoint<Dim>& gridPoint);
+		Value& value_unchecked (const GridPoint<Dim>& gridPoint);
 		
 		/**
 		 * Gives access to the function value at the grid point \a gridPoint by returning a \c const_reference to it.
@@ -210,7 +318,7 @@ namespace MultiDimGrid
 		 * In contrast to GridFunction::value(const GridPoint<Dim>& gridPoint) const, this method does not check if \a gridPoint
 		 * is within the range of the grid. It is thus slightly faster, but unsafe!
 		 */
-		const double& value_unchecked (const GridPoint<Dim>& gridPoint) const;
+		const Value& value_unchecked (const GridPoint<Dim>& gridPoint) const;
 		
 		/**
 		 * Overloads the bracket operator to give access to the function value at the grid point \a gridPoint by returning
@@ -221,7 +329,7 @@ namespace MultiDimGrid
 		 * 
 		 * This provides the same functionality as GridFunction::value(const GridPoint<Dim>& gridPoint).
 		 */
-		double& operator[] (const GridPoint<Dim>& gridPoint);
+		Value& operator[] (const GridPoint<Dim>& gridPoint);
 		
 		/**
 		 * Overloads the bracket operator to give access to the function value at the grid point \a gridPoint by returning
@@ -232,7 +340,7 @@ namespace MultiDimGrid
 		 * 
 		 * This provides the same functionality as GridFunction::value(const GridPoint<Dim>& gridPoint) const.
 		 */
-		const double& operator[] (const GridPoint<Dim>& gridPoint) const;
+		const Value& operator[] (const GridPoint<Dim>& gridPoint) const;
 		
 		/**
 		 * Gives access to the function value at the grid point with index \a index by returning a \c reference to it.
@@ -240,7 +348,7 @@ namespace MultiDimGrid
 		 * Contrary to GridFunction::value_at_index(std::size_t index) const, this allows to modify the function value and
 		 * will be called if the instance of GridFunction is not \c const-qualified.
 		 */
-		double& value_at_index (std::size_t index);
+		Value& value_at_index (std::size_t index);
 		
 		/**
 		 * Gives access to the function value at the grid point with index \a index by returning a \c const_reference to
@@ -249,7 +357,7 @@ namespace MultiDimGrid
 		 * Contrary to GridFunction::value_at_index(std::size_t index), this does not allow to modify the function value
 		 * and will be called if the instance of GridFunction is \c const-qualified.
 		 */
-		const double& value_at_index (std::size_t index) const;
+		const Value& value_at_index (std::size_t index) const;
 		
 		/**
 		 * Gives access to the function value at the grid point with index \a index by returning a reference to it.
@@ -260,7 +368,7 @@ namespace MultiDimGrid
 		 * In contrast to GridFunction::value_at_index(std::size_t index), this method does not check if \a index is within
 		 * the range of the grid. It is thus slightly faster, but unsafe!
 		 */
-		double& value_at_index_unchecked (std::size_t index);
+		Value& value_at_index_unchecked (std::size_t index);
 		
 		/**
 		 * Gives access to the function value at the grid point with index \a index by returning a \c const_reference to
@@ -272,7 +380,7 @@ namespace MultiDimGrid
 		 * In contrast to GridFunction::value_at_index(std::size_t index) const, this method does not check if \a index
 		 * is within the range of the grid. It is thus slightly faster, but unsafe!
 		 */
-		const double& value_at_index_unchecked (std::size_t index) const;
+		const Value& value_at_index_unchecked (std::size_t index) const;
 		
 		/**
 		 * Returns the interpolated function value of the discrete function at the coordinates \a coords.
@@ -296,107 +404,578 @@ namespace MultiDimGrid
 		double operator() (const Coordinates<Dim>& coords) const;
 		
 		/**
-		 * Returns the index differences between neighbouring grid points along each coordinate axis.
+		 * Returns the interpolated function value of the discrete function at the coordinates \a coords together with
+		 * the derivatives of the interpolation with respect to the coordinates along each axis.
 		 * 
-		 * This might be useful, if one wants to work with indices of grid points instead of the grid points themselves.
+		 * The grid cell is located and the function values at its corners are combined only once for the value and all
+		 * derivatives. As the interpolation is linear in the coordinate spacing of each axis, the derivatives are constant
+		 * within a cell along linearly spaced axes, and along logarithmically spaced ones they contain the corresponding
+		 * factor of the chain rule. Along single-point axes they vanish.
 		 */
-		IntegerArray<Dim> index_strides () const;
+		ValueAndGradient<Dim> interpolate_with_gradient (const Coordinates<Dim>& coords) const;
 		
 		/**
-		 * Returns the total number of grid points.
+		 * Returns the interpolated function value of the discrete function at the coordinates \a coords together with
+		 * the derivatives of the interpolation with respect to the coordinates along each axis.
 		 * 
-		 * This might be useful, if one wants to work with indices of grid points instead of the grid points themselves.
+		 * In contrast to GridFunction::interpolate_with_gradient, this method does not check if \a coords is within the
+		 * range of the grid. It is thus slightly faster, but unsafe!
 		 */
-		double point_number () const;
+		ValueAndGradient<Dim> interpolate_with_gradient_unchecked (const Coordinates<Dim>& coords) const;
 		
 		/**
-		 * Assignment operator taking care of properly copying the coordinate axes pointed to by the elements of GridFunction::CoordAxes
-		 * from the GridFunction \a otherGridFunction.
+		 * Computes the interpolated function values of the discrete function at the \a number coordinates stored in the
+		 * array \a coords and writes them to the array \a values, which has to be of the same length.
+		 * 
+		 * The coordinates are processed in batches. For each batch, the coordinate axes are queried once per axis for all
+		 * its coordinates and the arithmetic combining the function values at the neighbouring grid points is performed
+		 * for all of them at once, which allows it to be vectorized. The batches are distributed among OpenMP threads
+		 * according to \a schedule. If \a order is QueryOrder::CellSorted, the coordinates are sorted by grid cell before,
+		 * as described in MultiDimGrid::QueryOrder.
 		 */
-		GridFunction& operator= (const GridFunction& otherGridFunction);
+		void interpolate_many (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial, QueryOrder order = QueryOrder::Given) const;
 		
 		/**
-		 * Destructor deleting the coordinate axes pointed to by the elements of GridFunction::CoordAxes.
+		 * Computes the interpolated function values of the discrete function at the \a number coordinates stored in the
+		 * array \a coords and writes them to the array \a values, which has to be of the same length.
+		 * 
+		 * In contrast to GridFunction::interpolate_many(const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule, QueryOrder order) const,
+		 * this method does not check if \a coords are within the range of the grid. It is thus slightly faster, but unsafe!
 		 */
-		~GridFunction ();
+		void interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial, QueryOrder order = QueryOrder::Given) const;
+		
+		/**
+		 * Computes the interpolated function values of the discrete function at \a number coordinates given in the
+		 * structure-of-arrays form \a coordArrays and writes them to the array \a values, which has to be of the same
+		 * length as each of the arrays pointed to by the elements of \a coordArrays.
+		 * 
+		 * Apart from the coordinate layout, this provides the same functionality as GridFunction::interpolate_many(const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule, QueryOrder order) const.
+		 */
+		void interpolate_many (const CoordinateArrays<Dim>& coordArrays, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial, QueryOrder order = QueryOrder::Given) const;
+		
+		/**
+		 * Computes the interpolated function values of the discrete function at \a number coordinates given in the
+		 * structure-of-arrays form \a coordArrays and writes them to the array \a values, which has to be of the same
+		 * length as each of the arrays pointed to by the elements of \a coordArrays.
+		 * 
+		 * In contrast to GridFunction::interpolate_many(const CoordinateArrays<Dim>& coordArrays, double* values, std::size_t number, ParallelSchedule schedule, QueryOrder order) const,
+		 * this method does not check if the coordinates are within the range of the grid. It is thus slightly faster, but
+		 * unsafe!
+		 */
+		void interpolate_many_unchecked (const CoordinateArrays<Dim>& coordArrays, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial, QueryOrder order = QueryOrder::Given) const;
+		
+		/**
+		 * Computes the interpolated function values and gradients of the discrete function at the \a number coordinates
+		 * stored in the array \a coords, as done by GridFunction::interpolate_with_gradient, and writes them to the array
+		 * \a valuesAndGradients, which has to be of the same length. The interpolations are distributed among OpenMP threads
+		 * according to \a schedule.
+		 */
+		void interpolate_many_with_gradient (const Coordinates<Dim>* coords, ValueAndGradient<Dim>* valuesAndGradients, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Computes the interpolated function values and gradients of the discrete function at the \a number coordinates
+		 * stored in the array \a coords and writes them to the array \a valuesAndGradients, which has to be of the same
+		 * length.
+		 * 
+		 * In contrast to GridFunction::interpolate_many_with_gradient, this method does not check if \a coords are within
+		 * the range of the grid. It is thus slightly faster, but unsafe!
+		 */
+		void interpolate_many_with_gradient_unchecked (const Coordinates<Dim>* coords, ValueAndGradient<Dim>* valuesAndGradients, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns the integral of the discrete function over the whole grid, using the integration weights of the coordinate
+		 * axes.
+		 * 
+		 * The axes are integrated out one after another, so that the number of operations is proportional to the number
+		 * of grid points. The sums along each axis are carried out pairwise to limit the accumulation of rounding errors,
+		 * and the work is distributed among OpenMP threads according to \a schedule.
+		 */
+		double integrate (ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns the discrete function defined on the grid spanned up by the remaining coordinate axes that results from
+		 * integrating this function over the coordinate axes with the indices \a IntegrationAxes, using their integration
+		 * weights. The order of the remaining axes is preserved.
+		 * 
+		 * As for GridFunction::integrate, the integration axes are contracted one after another using pairwise summation,
+		 * and the work is distributed among OpenMP threads according to \a schedule. To integrate over all axes, use
+		 * GridFunction::integrate.
+		 */
+		template <std::size_t... IntegrationAxes>
+		GridFunction<Dim - sizeof...(IntegrationAxes), Value> integrate_over_axes (ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Writes the descriptions of the coordinate axes and the function values to the grid function file with name
+		 * \a fileName, from which the grid function can be restored using the constructor GridFunction(const std::string&).
+		 * The format is described in MultiDimGrid::write_grid_function_file. Grid functions defined on coordinate axes of
+		 * type AxisType::Custom can not be written.
+		 */
+		void write_to_file (const std::string& fileName) const;
+		
+		/**
+		 * Publishes the descriptions of the coordinate axes and the function values in a new POSIX shared memory segment
+		 * with name \a segmentName, which has to start with a slash and must not exist yet, see MultiDimGrid::publish_grid_function_segment.
+		 * Returns a read-only grid function attached to the segment, as returned by GridFunction::attach_to_shared_memory.
+		 * Grid functions defined on coordinate axes of type AxisType::Custom can not be published.
+		 * 
+		 * This allows all processes on a node to share a single copy of a huge grid function: one process publishes it,
+		 * all others attach to it. The segment is removed as soon as the last grid function attached to it in any process
+		 * is destroyed. As the returned grid function holds the only attachment at first, it has to be kept alive until
+		 * the other processes have attached, since discarding it removes the segment right away.
+		 */
+		[[gnu::warn_unused_result]] GridFunction publish_to_shared_memory (const std::string& segmentName) const;
+		
+		/**
+		 * Returns a grid function attached to the POSIX shared memory segment with name \a segmentName, published by
+		 * GridFunction::publish_to_shared_memory in any process. The function values are used in place without copying
+		 * them, as described in MultiDimGrid::attach_grid_function_segment.
+		 * 
+		 * The function values are read-only, see GridFunction::is_read_only, so they have to be accessed through a \c const
+		 * reference to the grid function. Moving the grid function keeps it attached, while copies of it own copies of
+		 * the function values and are not attached to the segment.
+		 */
+		static GridFunction attach_to_shared_memory (const std::string& segmentName);
+		
+		/**
+		 * Returns a refined version of the grid function, whose coordinate axes have the same types and ranges but
+		 * \a refinementFactors times as many axis intervals, as created by MultiDimGrid::create_refined_coordinate_axis.
+		 * 
+		 * The function values at the grid points that coincide with grid points of this grid function are copied, while
+		 * the MultiDimGrid::Function \a func is only evaluated at the new grid points. The evaluations are distributed
+		 * among OpenMP threads according to \a schedule, so \a func has to be safe to call concurrently unless \a schedule
+		 * is ParallelSchedule::Serial.
+		 */
+		GridFunction refine (const IntegerArray<Dim>& refinementFactors, const Function<Dim>& func, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Estimates the interpolation error of this grid function by comparing its interpolation with the function values
+		 * of \a refinedGridFunction, which has to be a refinement of it as returned by GridFunction::refine. The work
+		 * is distributed among OpenMP threads according to \a schedule.
+		 * 
+		 * As the error of the multi-linear interpolation decreases quadratically with the interval widths, the error of
+		 * \a refinedGridFunction is smaller by about the square of the refinement factors.
+		 */
+		RefinementErrorEstimate<Dim> refinement_error_estimate (const GridFunction& refinedGridFunction, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns the grid function on the grid spanned up by copies of the coordinate axes pointed to by the \a newCoordAxisPointers,
+		 * whose function values are the interpolations of this grid function at the new grid points. The coordinate range
+		 * of each new axis has to lie within the one of the corresponding axis of this grid function. If that is not the
+		 * case, an error message is written to the standard output and the program is terminated.
+		 * 
+		 * As both grids are tensor products of their axes, the multi-linear interpolation is carried out separably: the
+		 * interpolation from the old to the new axis points of each axis is a sparse matrix with two non-zero elements
+		 * per row, which is applied to the function values one axis after another. The number of operations is thus
+		 * proportional to the number of grid points times the number of dimensions instead of the number of corners of
+		 * a grid cell. The work of each axis is distributed among OpenMP threads according to \a schedule.
+		 */
+		GridFunction regrid (const CoordinateAxisPointers<Dim>& newCoordAxisPointers, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns a copy of the grid function, sharing its coordinate axes, whose function values are stored in the memory
+		 * layout \a layout, allocated according to the same storage policy. The copying is distributed among OpenMP threads
+		 * according to \a schedule.
+		 * 
+		 * The layout does not affect the results of any method, and indices of grid points always refer to the nested
+		 * enumeration described in GridFunction::FunctionValues. Integrations and writing to files are performed on a
+		 * temporary copy in the StorageLayout::RowMajor layout, which is the layout of all newly constructed grid functions.
+		 */
+		GridFunction with_storage_layout (StorageLayout layout, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns the memory layout of the function values.
+		 */
+		StorageLayout storage_layout () const;
+		
+		/**
+		 * Returns a copy of the grid function, sharing its coordinate axes, whose function values are allocated according
+		 * to the storage policy \a policy. The copying is distributed among OpenMP threads according to \a schedule.
+		 * 
+		 * The copy is the first write to the new memory pages, so each of them is placed on the NUMA node of the thread
+		 * copying the function values it contains. With ParallelSchedule::Static, the pages are thus spread evenly over
+		 * the NUMA nodes of all threads in contiguous blocks, in the same way as by a construction with this schedule.
+		 */
+		GridFunction with_storage_policy (const StoragePolicy& policy, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns the storage policy according to which the function values are allocated. Function values mapped from
+		 * a file or shared memory segment report MultiDimGrid::DefaultStoragePolicy, which is also used for copies of them.
+		 */
+		StoragePolicy storage_policy () const;
 		
-	private:
 		/**
-		 * Coordinate axes spanning up the grid.
+		 * Returns whether the function values are read-only, as for grid functions attached to a shared memory segment.
+		 * If that is the case, the non-\c const methods giving access to them write an error message to the standard
+		 * output and terminate the program, while writing through the unchecked ones results in a segmentation fault.
+		 */
+		bool is_read_only () const;
+		
+		/**
+		 * Returns a snapshot of the instrumentation counters of the grid function, see MultiDimGrid::InstrumentationEnabled.
+		 * 
+		 * The counters are updated by all threads without synchronization, so the snapshot is only exact if no other
+		 * thread uses the grid function at the same time.
+		 */
+		GridFunctionCounters instrumentation_counters () const;
+		
+		/**
+		 * Calls \a body(visit, value) once for every grid point, where \a visit is a const reference to a MultiDimGrid::GridPointVisit
+		 * describing the grid point and \a value is a reference to the function value there. The calls are distributed
+		 * among OpenMP threads according to \a schedule.
+		 * 
+		 * The grid points are visited as described in CoordinateGrid::for_each_point.
+		 */
+		template <class Body>
+		void for_each_value (const Body& body, ParallelSchedule schedule = ParallelSchedule::Serial);
+		
+		/**
+		 * Calls \a body(visit, value) once for every grid point, where \a visit is a const reference to a MultiDimGrid::GridPointVisit
+		 * describing the grid point and \a value is a const reference to the function value there. The calls are distributed
+		 * among OpenMP threads according to \a schedule.
+		 * 
+		 * The grid points are visited as described in CoordinateGrid::for_each_point.
 		 */
-		CoordinateAxisPointers<Dim> CoordAxes;
+		template <class Body>
+		void for_each_value (const Body& body, ParallelSchedule schedule = ParallelSchedule::Serial) const;
 		
 		/**
-		 * Index differences between neighbouring grid points along each coordinate axis.
+		 * Calls \a body(visit, value) once for every grid point within the box \a range, where \a visit is a const reference
+		 * to a MultiDimGrid::GridPointVisit describing the grid point and \a value is a reference to the function value
+		 * there. The calls are distributed among OpenMP threads according to \a schedule.
 		 * 
-		 * If there are n axes, the indices of the grid points (i_0, ... , i_j, ... , i_(n-1)) and (i_0, ... , i_j + 1, ... , i_(n-1)),
-		 * for example, differ by (num_axis_pts_(j+1) * ... * num_axis_pts_(n-1)). This value is stored in GridFunction::IndexStrides[j].
+		 * The grid points are visited as described in CoordinateGrid::for_each_point.
+		 */
+		template <class Body>
+		void for_each_value (const GridPointRange<Dim>& range, const Body& body, ParallelSchedule schedule = ParallelSchedule::Serial);
+		
+		/**
+		 * Calls \a body(visit, value) once for every grid point within the box \a range, where \a visit is a const reference
+		 * to a MultiDimGrid::GridPointVisit describing the grid point and \a value is a const reference to the function
+		 * value there. The calls are distributed among OpenMP threads according to \a schedule.
+		 * 
+		 * The grid points are visited as described in CoordinateGrid::for_each_point.
+		 */
+		template <class Body>
+		void for_each_value (const GridPointRange<Dim>& range, const Body& body, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Resets the instrumentation counters of the grid function to zero.
+		 */
+		void reset_instrumentation_counters () const;
+		
+		/**
+		 * Assignment operator copying the function values of the GridFunction \a otherGridFunction and sharing its coordinate
+		 * axes.
+		 */
+		GridFunction& operator= (const GridFunction& otherGridFunction) = default;
+		
+		/**
+		 * Move-assignment operator taking over the coordinate axes and function values of the GridFunction \a otherGridFunction
+		 * without copying them. \a otherGridFunction is left without a grid and must not be used anymore, except for
+		 * being assigned to or destroyed.
+		 */
+		GridFunction& operator= (GridFunction&& otherGridFunction) noexcept = default;
+		
+		/**
+		 * Default destructor. The coordinate axes are deleted as soon as no GridFunction shares them anymore.
 		 */
-		IntegerArray<Dim> IndexStrides;
+		~GridFunction () = default;
+	
+	protected:
+		/**
+		 * Writes the function values at the corners of the grid cell whose lower axis points are \a cellAxisPoints, ordered
+		 * as described in CoordinateGrid::CornerOffsets, to the array \a cornerValues. This is the only place where the
+		 * storage positions of the corners are derived from the memory layout.
+		 */
+		void gather_cell_corner_values (const GridPoint<Dim>& cellAxisPoints, double* cornerValues) const;
+	
+	private:
+		static_assert(std::is_same<Value, double>::value || std::is_same<Value, float>::value || std::is_same<Value, HalfFloat>::value, "MultiDimGrid::GridFunction Error: Value type is neither double, float nor HalfFloat");
+		
+		using CoordinateGrid<Dim>::CornerNumber;
+		using CoordinateGrid<Dim>::CoordAxes;
+		using CoordinateGrid<Dim>::IndexStrides;
+		using CoordinateGrid<Dim>::CornerOffsets;
+		using CoordinateGrid<Dim>::GridPointNumber;
+		using CoordinateGrid<Dim>::locate_cell;
+		using CoordinateGrid<Dim>::locate_cell_axis_point;
+		using CoordinateGrid<Dim>::cell_axis_point;
+		using CoordinateGrid<Dim>::interpolate_corner_values;
+		using CoordinateGrid<Dim>::axis_integration_weights;
+		using CoordinateGrid<Dim>::axis_coordinates;
+		using CoordinateGrid<Dim>::check_axis_point;
+		using CoordinateGrid<Dim>::check_coordinate;
+		using CoordinateGrid<Dim>::check_coordinates;
+		using CoordinateGrid<Dim>::check_index;
+		
+		/**
+		 * Number of coordinates processed together in a batch by GridFunction::interpolate_many. It is chosen such that
+		 * the function values at the corners of all grid cells in a batch fit into a buffer of 32 KiB.
+		 */
+		static constexpr std::size_t InterpolationBatchSize = (CornerNumber < 4096) ? (4096 / CornerNumber) : 1;
 		
 		/**
-		 * Total number of grid points.
+		 * Maximum number of grid points whose function values are evaluated together in a batch by the constructor taking
+		 * a MultiDimGrid::BatchFunction.
 		 */
-		std::size_t GridPointNumber;
+		static constexpr std::size_t BatchEvaluationSize = 256;
+		
+		/**
+		 * Maximum number of buckets into which the coordinates are sorted by GridFunction::interpolate_many with QueryOrder::CellSorted.
+		 * It is chosen such that the bucket counters and the positions the coordinates of each bucket are written to
+		 * stay within the caches during the sorting.
+		 */
+		static constexpr std::size_t MaximumSortBucketNumber = 16384;
+		
+		/**
+		 * Number of adjacent function values that are summed up simultaneously when integrating over a coordinate axis.
+		 */
+		static constexpr std::size_t ContractionBlockWidth = 64;
+		
+		/**
+		 * Maximum number of terms that are summed up directly, rather than pairwise, when integrating over a coordinate
+		 * axis.
+		 */
+		static constexpr std::size_t PairwiseSummationBaseLength = 8;
+		
+		/**
+		 * Maximum size in bytes of a tile in the StorageLayout::Tiled layout, which is the common memory page size. It
+		 * is exceeded only if even a tile of two axis points along each axis is larger.
+		 */
+		static constexpr std::size_t StorageTileSize = 4096;
+		
+		/**
+		 * Memory layout of the function values.
+		 */
+		StorageLayout Layout;
+		
+		/**
+		 * Storage positions of the function values in the StorageLayout::Tiled layout, given as the offsets contributed
+		 * by each axis point of each coordinate axis, whose sum is the position of the function value at a grid point.
+		 * It is empty in the StorageLayout::RowMajor layout.
+		 */
+		std::array<std::vector<std::size_t>, Dim> AxisStorageOffsets;
 		
 		/**
 		 * Internal 1-dimensional storage of the function values at each grid point.
 		 * 
 		 * The function values are stored in a nested fashion. If there are n axes, this means that the function value at
-		 * the grid point (i_0, ... , i_(n-1)) is stored at the vector element with index (i_0 * num_axis_pts_1 * ... * num_axis_pts_(n-1) + ... + i_(n-2) * num_axis_pts_(n-1) + i_(n-1)).
+		 * the grid point (i_0, ... , i_(n-1)) is stored at the buffer element with index (i_0 * num_axis_pts_1 * ... * num_axis_pts_(n-1) + ... + i_(n-2) * num_axis_pts_(n-1) + i_(n-1)).
+		 * 
+		 * The buffer either owns the function values or refers to the memory-mapped grid function file they were loaded
+		 * from.
+		 * 
+		 * In the StorageLayout::Tiled layout, the function values are instead stored at the positions given by GridFunction::AxisStorageOffsets.
 		 */
-		std::vector<double> FunctionValues;
+		FunctionValueBuffer<Value> FunctionValues;
 		
 		/**
-		 * Creates copies of the coordinate axes pointed to by the \a coordAxisPointers and returns MultiDimGrid::CoordinateAxisPointers
-		 * to them.
+		 * Indices of the instrumentation counters of a grid function.
+		 * 
+		 * The times are stored in nanoseconds.
 		 */
-		CoordinateAxisPointers<Dim> copy_coordinate_axes (const CoordinateAxisPointers<Dim>& coordAxisPointers) const;
+		enum InstrumentationCounter : std::size_t
+		{
+			InterpolationCounter,
+			CheckedInterpolationCounter,
+			FunctionEvaluationCounter,
+			FunctionEvaluationTimeCounter,
+			ConstructionTimeCounter,
+			InstrumentationCounterNumber
+		};
 		
 		/**
-		 * Computes and returns the index stride values corresponding the coordinate axes pointed to by the \a coordAxisPointers.
+		 * Instrumentation counters, which are also updated by const methods.
 		 */
-		IntegerArray<Dim> compute_index_strides (const CoordinateAxisPointers<Dim>& coordAxisPointers) const;
+		mutable InstrumentationCounters<InstrumentationCounterNumber> Counters;
 		
 		/**
-		 * Implements the interpolation in a nested fashion by recursively calling itself. In each recursion step the 1-dimensional
-		 * interpolation with respect to one of the coordinates \a coords is performed. \a i_axis denotes the nesting level,
-		 * i.e. the axis along which the 1-dimensional interpolation is currently performed, and \a gridPoint stores the
-		 * grid point from which the two neighbouring grid points lying on this axis are constructed.
+		 * Constructor instantiating a discrete function defined on a grid spanned up by the shared coordinate axes pointed
+		 * to by the \a sharedCoordAxes with the function values \a funcValues, which are taken over without copying them.
+		 * These have to be stored in the nested fashion described in GridFunction::FunctionValues.
+		 * 
+		 * This is used to create new grid functions on (a subset of) the axes of an existing one.
 		 */
-		double internal_recursive_interpolation (const Coordinates<Dim>& coords, const GridPoint<Dim>& gridPoint, std::size_t i_axis) const;
+		GridFunction (const SharedCoordinateAxisPointers<Dim>& sharedCoordAxes, FunctionValueBuffer<Value>&& funcValues);
 		
 		/**
-		 * Implements the interpolation in a nested fashion by recursively calling itself. In each recursion step the 1-dimensional
-		 * interpolation with respect to one of the coordinates \a coords is performed. \a i_axis denotes the nesting level,
-		 * i.e. the axis along which the 1-dimensional interpolation is currently performed, and \a gridPoint stores the
-		 * grid point from which the two neighbouring grid points lying on this axis are constructed.
-		 * 
-		 * In contrast to GridFunction::internal_recursive_interpolation, this method does not check if \a coords are within
-		 * the range of the grid. It is thus slightly faster, but unsafe!
+		 * Constructor instantiating a discrete function from the content \a fileContent of a grid function file, whose
+		 * function values are taken over without copying them.
 		 */
-		double internal_recursive_interpolation_unchecked (const Coordinates<Dim>& coords, const GridPoint<Dim>& gridPoint, std::size_t i_axis) const;
+		GridFunction (GridFunctionFileContent&& fileContent);
 		
 		/**
-		 * Checks if the axis point \a axisPoint of the coordinate axis pointed to by \a axis is out of range. If that is
-		 * the case, an error message is written to the standard output and the program is terminated. The error message
-		 * contains \a location, which specifies in which member the point range is checked.
+		 * Constructor instantiating a discrete function defined on a grid spanned up by the shared coordinate axes pointed
+		 * to by the \a sharedCoordAxes, whose uninitialized function values are stored in the memory layout \a layout and
+		 * allocated according to the storage policy \a policy.
 		 */
-		void check_axis_point (std::size_t axisPoint, const CoordinateAxis* axis, const char* location) const;
+		GridFunction (const SharedCoordinateAxisPointers<Dim>& sharedCoordAxes, StorageLayout layout, const StoragePolicy& policy);
 		
 		/**
-		 * Checks if the coordinate \a coord of the coordinate axis pointed to by \a axis is out of range. If that is the
-		 * case, an error message is written to the standard output and the program is terminated. The error message contains
-		 * \a location, which specifies in which member the coordinate range is checked.
+		 * Grid functions of all dimensions need to use each other's constructor above.
 		 */
-		void check_coordinate (double coord, const CoordinateAxis* axis, const char* location) const;
+		template <std::size_t OtherDim, class OtherValue>
+		friend class GridFunction;
 		
 		/**
-		 * Checks if the index \a index is out of range. If that is the case, an error message is written to the standard
+		 * An InterpolationCursor gathers the function values at the corners of grid cells directly from the storage.
+		 */
+		friend class InterpolationCursor<Dim, Value>;
+		
+		/**
+		 * A StaticGridFunction locates grid cells along its statically typed axes and interpolates the gathered corner
+		 * values like the grid function itself.
+		 */
+		template <class... Axes>
+		friend class StaticGridFunction;
+		
+		/**
+		 * A MultiFieldGridFunction creates grid functions of single fields on its own shared coordinate axes.
+		 */
+		template <std::size_t OtherDim, std::size_t FieldNumber, class OtherValue>
+		friend class MultiFieldGridFunction;
+		
+		/**
+		 * A LazyGridFunction hands its computed function values to a grid function on its own shared coordinate axes.
+		 */
+		friend class LazyGridFunction<Dim, Value>;
+		
+		/**
+		 * Returns a buffer referring to the function values contained in the content \a fileContent of a mapped grid function
+		 * file. If their size does not match the one of \a Value, an error message is written to the standard output
+		 * and the program is terminated.
+		 */
+		static FunctionValueBuffer<Value> mapped_function_values (const GridFunctionFileContent& fileContent);
+		
+		/**
+		 * Checks if the number of function values matches the number of grid points. If that is not the case, an error
+		 * message is written to the standard output and the program is terminated.
+		 */
+		void check_function_value_number () const;
+		
+		/**
+		 * Checks if the function values are read-only. If that is the case, an error message is written to the standard
 		 * output and the program is terminated. The error message contains \a location, which specifies in which member
-		 * the index range is checked.
+		 * the function values would have been modified.
+		 */
+		void check_writable (const char* location) const;
+		
+		/**
+		 * Sets the function value of each grid point to the value returned by \a evaluation for the coordinates of this
+		 * grid point. The evaluations are distributed among OpenMP threads according to \a schedule.
+		 * 
+		 * GridFunction::FunctionValues has to be allocated with GridFunction::GridPointNumber elements beforehand.
+		 */
+		template <class Evaluation>
+		void evaluate_function_values (const Evaluation& evaluation, ParallelSchedule schedule);
+		
+		/**
+		 * Returns the result of \a evaluation(\a coords), counting the evaluation and the time spent in it if the
+		 * instrumentation is enabled.
 		 */
-		void check_index (std::size_t index, const char* location) const;
+		template <class Evaluation>
+		double instrumented_evaluation (const Evaluation& evaluation, const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Sets the function values to the values of \a batchEvaluation at the coordinates of all grid points, calling it
+		 * for batches of grid points as described for the constructor taking a MultiDimGrid::BatchFunction. The batches
+		 * are distributed among OpenMP threads according to \a schedule.
+		 */
+		template <class BatchEvaluation>
+		void evaluate_function_value_batches (const BatchEvaluation& batchEvaluation, ParallelSchedule schedule);
+		
+		/**
+		 * Determines the grid cell that contains the coordinates \a coords, writes the interpolation weights of \a coords
+		 * within the cell along each axis to \a interpolationWeights and the function values at its corners, ordered
+		 * as described in CoordinateGrid::CornerOffsets, to the array \a cornerValues.
+		 */
+		void gather_corner_values (const Coordinates<Dim>& coords, DoubleArray<Dim>& interpolationWeights, double* cornerValues) const;
+		
+		/**
+		 * Returns the position of the function value at the grid point with index \a index in GridFunction::FunctionValues.
+		 */
+		std::size_t storage_index (std::size_t index) const;
+		
+		/**
+		 * Returns the position of the function value at the grid point described by \a visit in GridFunction::FunctionValues,
+		 * which in contrast to GridFunction::storage_index does not require any integer divisions.
+		 */
+		std::size_t storage_index (const GridPointVisit<Dim>& visit) const;
+		
+		/**
+		 * Computes and returns the axis storage offsets corresponding to the memory layout \a layout, as described in
+		 * GridFunction::AxisStorageOffsets.
+		 */
+		std::array<std::vector<std::size_t>, Dim> compute_axis_storage_offsets (StorageLayout layout) const;
+		
+		/**
+		 * Returns the number of function values that need to be stored in the memory layout GridFunction::Layout.
+		 */
+		std::size_t storage_value_number () const;
+		
+		/**
+		 * Implements the batched interpolation at \a number coordinates, which are accessed through \a coordinateAccess,
+		 * by calling \a coordinateAccess(i_coords, i_axis) for the coordinate with index \a i_coords along the axis with
+		 * index \a i_axis. The interpolated function values are written to \a values, and the batches are distributed
+		 * among OpenMP threads according to \a schedule. If \a checkCoordinates is \c true, it is checked whether the
+		 * coordinates are within the range of the grid. The coordinates are processed in the order \a order.
+		 */
+		template <class CoordinateAccess>
+		void internal_batch_interpolation (const CoordinateAccess& coordinateAccess, double* values, std::size_t number, ParallelSchedule schedule, bool checkCoordinates, QueryOrder order) const;
+		
+		/**
+		 * Interpolates the discrete function at the \a number coordinates accessed through \a coordinateAccess in the given
+		 * order, batch by batch, as described in GridFunction::internal_batch_interpolation.
+		 */
+		template <class CoordinateAccess>
+		void interpolate_batches (const CoordinateAccess& coordinateAccess, double* values, std::size_t number, ParallelSchedule schedule, bool checkCoordinates) const;
+		
+		/**
+		 * Interpolates the discrete function at the \a number coordinates accessed through \a coordinateAccess in the order
+		 * QueryOrder::CellSorted, as described in GridFunction::internal_batch_interpolation. The coordinates are bucketed
+		 * by the storage position of the lowest corner of their grid cell, using buckets whose width is the smallest power
+		 * of two for which there are neither more buckets than coordinates nor more than GridFunction::MaximumSortBucketNumber.
+		 */
+		template <class CoordinateAccess>
+		void interpolate_cell_sorted (const CoordinateAccess& coordinateAccess, double* values, std::size_t number, ParallelSchedule schedule, bool checkCoordinates) const;
+		
+		/**
+		 * Interpolates the discrete function at the \a batchLength coordinates starting with index \a i_firstCoords,
+		 * which are accessed through \a coordinateAccess as described in GridFunction::internal_batch_interpolation.
+		 * The interpolated function values are written to the corresponding elements of \a values.
+		 */
+		template <class CoordinateAccess>
+		void interpolate_batch (const CoordinateAccess& coordinateAccess, double* values, std::size_t i_firstCoords, std::size_t batchLength, bool checkCoordinates) const;
+		
+		/**
+		 * Integrates the function values \a values of type \a InputValue, which are stored in the nested fashion described
+		 * in GridFunction::FunctionValues on a grid with the numbers of axis points \a shape, over the axis with index
+		 * \a i_axis using the integration weights \a integrationWeights of that axis. Returns the resulting function values
+		 * on the grid without this axis in \c double precision and removes the axis from \a shape. The work is distributed
+		 * among OpenMP threads according to \a schedule.
+		 */
+		template <class InputValue>
+		static std::vector<double> contract_axis (const InputValue* values, std::vector<std::size_t>& shape, std::size_t i_axis, const std::vector<double>& integrationWeights, ParallelSchedule schedule);
+		
+		/**
+		 * Interpolates the function values \a values of type \a InputValue, which are stored in the nested fashion described
+		 * in GridFunction::FunctionValues on a grid with the numbers of axis points \a shape, along the axis with index
+		 * \a i_axis to the new axis points located on that axis at the \a axisLocations. Writes the resulting function
+		 * values of type \a OutputValue to \a interpolatedValues in the same fashion and replaces the number of axis points
+		 * in \a shape by the number of new ones. The work is distributed among OpenMP threads according to \a schedule.
+		 */
+		template <class InputValue, class OutputValue>
+		static void interpolate_axis (const InputValue* values, OutputValue* interpolatedValues, std::vector<std::size_t>& shape, std::size_t i_axis, const std::vector<AxisLocation>& axisLocations, ParallelSchedule schedule);
+		
+		/**
+		 * Computes the \a width weighted sums of the \a number rows of the array \a values, where the rows are separated
+		 * by \a stride elements, using the weights \a weights, and writes them to \a sums. That is, sums[i] is set to
+		 * the sum of weights[j] * values[j*stride + i] over all j. The sums are computed pairwise, i.e. by recursively
+		 * splitting the rows into two halves in \c double precision, and \a width must not exceed GridFunction::ContractionBlockWidth.
+		 */
+		template <class InputValue>
+		static void pairwise_weighted_sum (const InputValue* values, const double* weights, std::size_t number, std::size_t stride, std::size_t width, double* sums);
+	
 	};
 }
 
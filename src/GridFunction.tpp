@@ -1,518 +1,1574 @@
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+template <std::size_t Dim, class Value>
+constexpr std::size_t MultiDimGrid::GridFunction<Dim, Value>::InterpolationBatchSize;
+
+template <std::size_t Dim, class Value>
+constexpr std::size_t MultiDimGrid::GridFunction<Dim, Value>::ContractionBlockWidth;
+
+template <std::size_t Dim, class Value>
+constexpr std::size_t MultiDimGrid::GridFunction<Dim, Value>::PairwiseSummationBaseLength;
+
+template <std::size_t Dim, class Value>
+constexpr std::size_t MultiDimGrid::GridFunction<Dim, Value>::BatchEvaluationSize;
+
+template <std::size_t Dim, class Value>
+constexpr std::size_t MultiDimGrid::GridFunction<Dim, Value>::StorageTileSize;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // public
 
-template <std::size_t Dim>
-MultiDimGrid::GridFunction<Dim>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const double funcValue) :
-	CoordAxes(copy_coordinate_axes(coordAxisPointers)),
-	IndexStrides(compute_index_strides(CoordAxes)),
-	GridPointNumber( IndexStrides[0] * CoordAxes[0]->point_number() ),	// the 0-th index stride is given by the product of the numbers of points of all coordinate axes except for the 0-th
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const Value funcValue) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Layout(StorageLayout::RowMajor),
+	AxisStorageOffsets(),
 	FunctionValues(GridPointNumber, funcValue)	// assign the value 'funcValue' to every grid point
 {
 	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
 }
 
-template <std::size_t Dim>
-MultiDimGrid::GridFunction<Dim>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const Function<Dim>& func) :
-	CoordAxes(copy_coordinate_axes(coordAxisPointers)),
-	IndexStrides(compute_index_strides(CoordAxes)),
-	GridPointNumber( IndexStrides[0] * CoordAxes[0]->point_number() ),	// the 0-th index stride is given by the product of the numbers of points of all coordinate axes except for the 0-th
-	FunctionValues()
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const Function<Dim>& func, const ParallelSchedule schedule, const StoragePolicy& policy) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Layout(StorageLayout::RowMajor),
+	AxisStorageOffsets(),
+	FunctionValues(GridPointNumber, policy)	// the uninitialized function values are first written by the evaluations
 {
 	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
 	
-	for ( std::size_t index = 0; index < GridPointNumber; ++index )	// iterate through the whole index range, determine the corresponding coordinates for each index value, and evaluate 'func' at these coordinates
-	{
-		const Coordinates<Dim> coords = coordinates_at_index_unchecked(index);
-		
-		FunctionValues.push_back( func(coords) );
-	}
+	evaluate_function_values(func, schedule);	// evaluate 'func' at the coordinates of every grid point
 }
 
-template <std::size_t Dim>
+template <std::size_t Dim, class Value>
+template <class Callable, typename std::enable_if<std::is_convertible<decltype(std::declval<const Callable&>()(std::declval<const MultiDimGrid::Coordinates<Dim>&>())), double>::value, int>::type>
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const Callable& func, const ParallelSchedule schedule, const StoragePolicy& policy) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Layout(StorageLayout::RowMajor),
+	AxisStorageOffsets(),
+	FunctionValues(GridPointNumber, policy)	// the uninitialized function values are first written by the evaluations
+{
+	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
+	
+	evaluate_function_values(func, schedule);	// evaluate 'func' at the coordinates of every grid point
+}
+
+template <std::size_t Dim, class Value>
+template <class BatchCallable, typename std::enable_if<std::is_void<decltype(std::declval<const BatchCallable&>()(std::declval<const MultiDimGrid::CoordinateArrays<Dim>&>(), std::declval<double*>(), std::declval<std::size_t>()))>::value, long>::type>
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const BatchCallable& batchFunc, const ParallelSchedule schedule, const StoragePolicy& policy) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Layout(StorageLayout::RowMajor),
+	AxisStorageOffsets(),
+	FunctionValues(GridPointNumber, policy)	// the uninitialized function values are first written by the evaluations
+{
+	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
+	
+	evaluate_function_value_batches(batchFunc, schedule);	// evaluate 'batchFunc' at the coordinates of all grid points, batch by batch
+}
+
+template <std::size_t Dim, class Value>
 template <class Class>
-MultiDimGrid::GridFunction<Dim>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const MemberFunctionPointer<Dim, Class>  memberFuncPointer, Class& object) :
-	CoordAxes(copy_coordinate_axes(coordAxisPointers)),
-	IndexStrides(compute_index_strides(CoordAxes)),
-	GridPointNumber( IndexStrides[0] * CoordAxes[0]->point_number() ),	// the 0-th index stride is given by the product of the numbers of points of all coordinate axes except for the 0-th
-	FunctionValues()
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const MemberFunctionPointer<Dim, Class>  memberFuncPointer, Class& object, const ParallelSchedule schedule, const StoragePolicy& policy) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Layout(StorageLayout::RowMajor),
+	AxisStorageOffsets(),
+	FunctionValues(GridPointNumber, policy)	// the uninitialized function values are first written by the evaluations
 {
 	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
 	
-	for ( std::size_t index = 0; index < GridPointNumber; ++index ) // iterate through the whole index range, determine the corresponding coordinates for each index value, and evaluate 'object.*memberFuncPointer' at these coordinates
-	{
-		const Coordinates<Dim> coords = coordinates_at_index_unchecked(index);
-		
-		FunctionValues.push_back( (object.*memberFuncPointer)(coords) );
-	}
+	evaluate_function_values( [&object, memberFuncPointer] (const Coordinates<Dim>& coords) { return (object.*memberFuncPointer)(coords); }, schedule );	// evaluate 'object.*memberFuncPointer' at the coordinates of every grid point
 }
 
-template <std::size_t Dim>
+template <std::size_t Dim, class Value>
 template <class Class>
-MultiDimGrid::GridFunction<Dim>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const ConstMemberFunctionPointer<Dim, Class>  constMemberFuncPointer, const Class& constObject) :
-	CoordAxes(copy_coordinate_axes(coordAxisPointers)),
-	IndexStrides(compute_index_strides(CoordAxes)),
-	GridPointNumber( IndexStrides[0] * CoordAxes[0]->point_number() ),	// the 0-th index stride is given by the product of the numbers of points of all coordinate axes except for the 0-th
-	FunctionValues()
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const ConstMemberFunctionPointer<Dim, Class>  constMemberFuncPointer, const Class& constObject, const ParallelSchedule schedule, const StoragePolicy& policy) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Layout(StorageLayout::RowMajor),
+	AxisStorageOffsets(),
+	FunctionValues(GridPointNumber, policy)	// the uninitialized function values are first written by the evaluations
 {
 	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
 	
-	for ( std::size_t index = 0; index < GridPointNumber; ++index ) // iterate through the whole index range, determine the corresponding coordinates for each index value, and evaluate 'object.*memberFuncPointer' at these coordinates
-	{
-		const Coordinates<Dim> coords = coordinates_at_index_unchecked(index);
-		
-		FunctionValues.push_back( (constObject.*constMemberFuncPointer)(coords) );
-	}
+	evaluate_function_values( [&constObject, constMemberFuncPointer] (const Coordinates<Dim>& coords) { return (constObject.*constMemberFuncPointer)(coords); }, schedule );	// evaluate 'constObject.*constMemberFuncPointer' at the coordinates of every grid point
 }
 
-template <std::size_t Dim>
-MultiDimGrid::GridFunction<Dim>::GridFunction (const GridFunction& otherGridFunction) :
-	CoordAxes(copy_coordinate_axes(otherGridFunction.CoordAxes)),
-	IndexStrides(otherGridFunction.IndexStrides),
-	GridPointNumber(otherGridFunction.GridPointNumber),
-	FunctionValues(otherGridFunction.FunctionValues)
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const std::vector<Value>& funcValues) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Layout(StorageLayout::RowMajor),
+	AxisStorageOffsets(),
+	FunctionValues(funcValues)
 {
 	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
+	
+	check_function_value_number();
 }
 
-template <std::size_t Dim>
-MultiDimGrid::Coordinates<Dim> MultiDimGrid::GridFunction<Dim>::coordinates (const GridPoint<Dim>& gridPoint) const
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const std::string& fileName) :
+	GridFunction(map_grid_function_file(fileName))
+{}
+
+template <std::size_t Dim, class Value>
+Value& MultiDimGrid::GridFunction<Dim, Value>::value (const GridPoint<Dim>& gridPoint)
 {
-	Coordinates<Dim> coords;
+	check_writable("GridFunction::value");
+	
+	std::size_t index = 0;
 	
 	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
 		const std::size_t axisPoint = gridPoint[i_axis];
 		
-		const CoordinateAxis* axis = CoordAxes[i_axis];
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
 		
-		check_axis_point(axisPoint, axis, "coordinates");
+		check_axis_point(axisPoint, axis, "GridFunction::value");
 		
-		coords[i_axis] = axis->coordinate_unchecked(axisPoint);	// for each axis read off the coordinate of the corresponding axis point
+		index += axisPoint * IndexStrides[i_axis];	// the index associated to a grid point is found by multiplying all its individual axis point numbers with their corresponding index stride values and summing up the results
 	}
 	
-	return coords;
+	return FunctionValues[storage_index(index)];
 }
 
-template <std::size_t Dim>
-MultiDimGrid::Coordinates<Dim> MultiDimGrid::GridFunction<Dim>::coordinates_unchecked (const GridPoint<Dim>& gridPoint) const
+template <std::size_t Dim, class Value>
+const Value& MultiDimGrid::GridFunction<Dim, Value>::value (const GridPoint<Dim>& gridPoint) const
 {
-	Coordinates<Dim> coords;
+	std::size_t index = 0;
 	
 	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
 		const std::size_t axisPoint = gridPoint[i_axis];
 		
-		const CoordinateAxis* axis = CoordAxes[i_axis];
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
+		
+		check_axis_point(axisPoint, axis, "GridFunction::value");
 		
-		coords[i_axis] = axis->coordinate_unchecked(axisPoint);	// for each axis read off the coordinate of the corresponding axis point
+		index += axisPoint * IndexStrides[i_axis];	// the index associated to a grid point is found by multiplying all its individual axis point numbers with their corresponding index stride values and summing up the results
 	}
 	
-	return coords;
+	return FunctionValues[storage_index(index)];
 }
 
-template <std::size_t Dim>
-MultiDimGrid::Coordinates<Dim> MultiDimGrid::GridFunction<Dim>::coordinates_at_index (const std::size_t index) const
+template <std::size_t Dim, class Value>
+Value& MultiDimGrid::GridFunction<Dim, Value>::value_unchecked (const GridPoint<Dim>& gridPoint)
 {
-	check_index(index, "coordinates_at_index");
+	std::size_t index = 0;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const std::size_t axisPoint = gridPoint[i_axis];
+		
+		index += axisPoint * IndexStrides[i_axis];	// the index associated to a grid point is found by multiplying all its individual axis point numbers with their corresponding index stride values and summing up the results
+	}
 	
-	return coordinates_at_index_unchecked(index);
+	return FunctionValues[storage_index(index)];
 }
 
-template <std::size_t Dim>
-MultiDimGrid::Coordinates<Dim> MultiDimGrid::GridFunction<Dim>::coordinates_at_index_unchecked (const std::size_t index) const
+template <std::size_t Dim, class Value>
+const Value& MultiDimGrid::GridFunction<Dim, Value>::value_unchecked (const GridPoint<Dim>& gridPoint) const
 {
-	Coordinates<Dim> coords;
-	
-	std::size_t reducedIndex = index;
+	std::size_t index = 0;
 	
-	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// if the index is divided by the outermost (i_axis=0) stride, the result is given by the value of the outermost axis point plus a rest that is smaller than one, but integer division in C++ omits this rest automatically; if one then subtracts the product of this axis point value and its stride to get an reduced index, this procedure can be repeated for the inner axes
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
-		const std::size_t stride = IndexStrides[i_axis];
-		
-		const std::size_t axisPoint = reducedIndex / stride;
+		const std::size_t axisPoint = gridPoint[i_axis];
 		
-		const CoordinateAxis* axis = CoordAxes[i_axis];
+		index += axisPoint * IndexStrides[i_axis];	// the index associated to a grid point is found by multiplying all its individual axis point numbers with their corresponding index stride values and summing up the results
+	}
+	
+	return FunctionValues[storage_index(index)];
+}
+
+template <std::size_t Dim, class Value>
+Value& MultiDimGrid::GridFunction<Dim, Value>::operator[] (const GridPoint<Dim>& gridPoint)
+{
+	return value(gridPoint);
+}
+
+template <std::size_t Dim, class Value>
+const Value& MultiDimGrid::GridFunction<Dim, Value>::operator[] (const GridPoint<Dim>& gridPoint) const
+{
+	return value(gridPoint);
+}
+
+template <std::size_t Dim, class Value>
+Value& MultiDimGrid::GridFunction<Dim, Value>::value_at_index (const std::size_t index)
+{
+	check_writable("GridFunction::value_at_index");
+	check_index(index, "GridFunction::value_at_index");
+	
+	return value_at_index_unchecked(index);
+}
+
+template <std::size_t Dim, class Value>
+const Value& MultiDimGrid::GridFunction<Dim, Value>::value_at_index (const std::size_t index) const
+{
+	check_index(index, "GridFunction::value_at_index");
+	
+	return value_at_index_unchecked(index);
+}
+
+template <std::size_t Dim, class Value>
+Value& MultiDimGrid::GridFunction<Dim, Value>::value_at_index_unchecked (const std::size_t index)
+{
+	return FunctionValues[storage_index(index)];
+}
+
+template <std::size_t Dim, class Value>
+const Value& MultiDimGrid::GridFunction<Dim, Value>::value_at_index_unchecked (const std::size_t index) const
+{
+	return FunctionValues[storage_index(index)];
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::GridFunction<Dim, Value>::interpolate (const Coordinates<Dim>& coords) const
+{
+	check_coordinates(coords, "GridFunction::interpolate");
+	
+	Counters.add(CheckedInterpolationCounter, 1);
+	
+	return interpolate_unchecked(coords);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::GridFunction<Dim, Value>::interpolate_unchecked (const Coordinates<Dim>& coords) const
+{
+	Counters.add(InterpolationCounter, 1);
+	
+	DoubleArray<Dim> interpolationWeights;
+	
+	std::array<double, CornerNumber> cornerValues;
+	
+	gather_corner_values(coords, interpolationWeights, cornerValues.data());	// to interpolate the grid function, one has to average over its values at all the 2^'Dim' corners of the grid cell containing 'coords', using the appropriate interpolation weights
+	
+	return interpolate_corner_values(cornerValues.data(), interpolationWeights);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::GridFunction<Dim, Value>::operator() (const Coordinates<Dim>& coords) const
+{
+	return interpolate(coords);
+}
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::ValueAndGradient<Dim> MultiDimGrid::GridFunction<Dim, Value>::interpolate_with_gradient (const Coordinates<Dim>& coords) const
+{
+	check_coordinates(coords, "GridFunction::interpolate_with_gradient");
+	
+	Counters.add(CheckedInterpolationCounter, 1);
+	
+	return interpolate_with_gradient_unchecked(coords);
+}
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::ValueAndGradient<Dim> MultiDimGrid::GridFunction<Dim, Value>::interpolate_with_gradient_unchecked (const Coordinates<Dim>& coords) const
+{
+	Counters.add(InterpolationCounter, 1);
+	
+	DoubleArray<Dim> interpolationWeights;
+	
+	std::array<double, CornerNumber> cornerValues;
+	
+	gather_corner_values(coords, interpolationWeights, cornerValues.data());
+	
+	std::array<std::array<double, CornerNumber / 2>, Dim> cornerDerivatives;	// derivatives with respect to the interpolation weight along each axis, interpolated along the axes treated so far
+	
+	std::size_t remainingCornerNumber = CornerNumber;
+	
+	for ( std::size_t i_bit = 0; i_bit < Dim; ++i_bit )	// the same sweep as in 'interpolate_corner_values', which in addition takes the differences of each pair of corners as derivatives along the current axis and interpolates the derivatives along the previous ones
+	{
+		const std::size_t i_axis = Dim - 1 - i_bit;
+		const double interpolationWeight = interpolationWeights[i_axis];
 		
-		coords[i_axis] = axis->coordinate_unchecked(axisPoint);	// read off the coordinate of the corresponding axis point
+		remainingCornerNumber /= 2;
 		
-		reducedIndex -= axisPoint * stride;
+		for ( std::size_t i_corner = 0; i_corner < remainingCornerNumber; ++i_corner )
+		{
+			const double lowerValue = cornerValues[2 * i_corner];
+			const double higherValue = cornerValues[2 * i_corner + 1];
+			
+			cornerValues[i_corner] = lowerValue * (1.0 - interpolationWeight) + higherValue * interpolationWeight;
+			
+			for ( std::size_t i_previousAxis = i_axis + 1; i_previousAxis < Dim; ++i_previousAxis )
+			{
+				double* derivatives = cornerDerivatives[i_previousAxis].data();
+				
+				derivatives[i_corner] = derivatives[2 * i_corner] * (1.0 - interpolationWeight) + derivatives[2 * i_corner + 1] * interpolationWeight;
+			}
+			
+			cornerDerivatives[i_axis][i_corner] = higherValue - lowerValue;
+		}
+	}
+	
+	ValueAndGradient<Dim> valueAndGradient;
+	
+	valueAndGradient.Value = cornerValues[0];
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// the chain rule converts the derivatives with respect to the interpolation weights into derivatives with respect to the coordinates
+	{
+		valueAndGradient.Gradient[i_axis] = cornerDerivatives[i_axis][0] * CoordAxes[i_axis]->interpolation_weight_derivative_unchecked(coords[i_axis]);
 	}
 	
-	return coords;
+	return valueAndGradient;
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_many (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule, const QueryOrder order) const
+{
+	internal_batch_interpolation( [coords] (const std::size_t i_coords, const std::size_t i_axis) { return coords[i_coords][i_axis]; }, values, number, schedule, true, order );
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule, const QueryOrder order) const
+{
+	internal_batch_interpolation( [coords] (const std::size_t i_coords, const std::size_t i_axis) { return coords[i_coords][i_axis]; }, values, number, schedule, false, order );
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_many (const CoordinateArrays<Dim>& coordArrays, double* values, const std::size_t number, const ParallelSchedule schedule, const QueryOrder order) const
+{
+	internal_batch_interpolation( [&coordArrays] (const std::size_t i_coords, const std::size_t i_axis) { return coordArrays[i_axis][i_coords]; }, values, number, schedule, true, order );
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_many_unchecked (const CoordinateArrays<Dim>& coordArrays, double* values, const std::size_t number, const ParallelSchedule schedule, const QueryOrder order) const
+{
+	internal_batch_interpolation( [&coordArrays] (const std::size_t i_coords, const std::size_t i_axis) { return coordArrays[i_axis][i_coords]; }, values, number, schedule, false, order );
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_many_with_gradient (const Coordinates<Dim>* coords, ValueAndGradient<Dim>* valuesAndGradients, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, valuesAndGradients] (const std::size_t i_coords)
+	{
+		valuesAndGradients[i_coords] = interpolate_with_gradient(coords[i_coords]);
+	});
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_many_with_gradient_unchecked (const Coordinates<Dim>* coords, ValueAndGradient<Dim>* valuesAndGradients, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, valuesAndGradients] (const std::size_t i_coords)
+	{
+		valuesAndGradients[i_coords] = interpolate_with_gradient_unchecked(coords[i_coords]);
+	});
 }
 
-template <std::size_t Dim>
-MultiDimGrid::DoubleArray<Dim> MultiDimGrid::GridFunction<Dim>::integration_weights (const GridPoint<Dim>& gridPoint) const
+template <std::size_t Dim, class Value>
+double MultiDimGrid::GridFunction<Dim, Value>::integrate (const ParallelSchedule schedule) const
 {
-	DoubleArray<Dim> weights;
+	if ( Layout != StorageLayout::RowMajor )	// the contractions rely on the nested storage of the function values
+	{
+		return with_storage_layout(StorageLayout::RowMajor, schedule).integrate(schedule);
+	}
+	
+	std::vector<std::size_t> shape;
 	
 	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
-		const std::size_t axisPoint = gridPoint[i_axis];
-		
-		const CoordinateAxis* axis = CoordAxes[i_axis];
-		
-		check_axis_point(axisPoint, axis, "integration_weight");
-		
-		weights[i_axis] = axis->integration_weight_unchecked(axisPoint);	// read off the integration weight of the corresponding axis point
+		shape.push_back(CoordAxes[i_axis]->point_number());
+	}
+	
+	std::vector<double> values = contract_axis(FunctionValues.data(), shape, 0, axis_integration_weights(0), schedule);	// integrate out the outermost axis first, as this allows to sum up contiguous rows of function values
+	
+	for ( std::size_t i_axis = 1; i_axis < Dim; ++i_axis )	// then the remaining outermost axis is always the one with index 'i_axis'
+	{
+		values = contract_axis(values.data(), shape, 0, axis_integration_weights(i_axis), schedule);
 	}
 	
-	return weights;
+	return values[0];
 }
 
-template <std::size_t Dim>
-MultiDimGrid::DoubleArray<Dim> MultiDimGrid::GridFunction<Dim>::integration_weights_unchecked (const GridPoint<Dim>& gridPoint) const
+template <std::size_t Dim, class Value>
+template <std::size_t... IntegrationAxes>
+MultiDimGrid::GridFunction<Dim - sizeof...(IntegrationAxes), Value> MultiDimGrid::GridFunction<Dim, Value>::integrate_over_axes (const ParallelSchedule schedule) const
 {
-	DoubleArray<Dim> weights;
+	constexpr std::size_t IntegrationAxisNumber = sizeof...(IntegrationAxes);
+	constexpr std::size_t ReducedDim = Dim - IntegrationAxisNumber;
+	
+	static_assert(IntegrationAxisNumber != 0, "MultiDimGrid::GridFunction::integrate_over_axes Error: No integration axes specified");
+	static_assert(IntegrationAxisNumber < Dim, "MultiDimGrid::GridFunction::integrate_over_axes Error: Integration over all axes has to be performed with 'integrate'");
+	
+	if ( Layout != StorageLayout::RowMajor )	// the contractions rely on the nested storage of the function values
+	{
+		return with_storage_layout(StorageLayout::RowMajor, schedule).template integrate_over_axes<IntegrationAxes...>(schedule);
+	}
+	
+	const IntegerArray<IntegrationAxisNumber> integrationAxes = {{IntegrationAxes...}};
+	
+	std::array<bool, Dim> isIntegrationAxis;
+	
+	isIntegrationAxis.fill(false);
+	
+	for ( std::size_t i_integrationAxis = 0; i_integrationAxis < IntegrationAxisNumber; ++i_integrationAxis )
+	{
+		const std::size_t i_axis = integrationAxes[i_integrationAxis];
+		
+		if ( (i_axis >= Dim) || isIntegrationAxis[i_axis] )
+		{
+			std::cout << std::endl
+					  << " MultiDimGrid::GridFunction::integrate_over_axes Error: Integration axes are not distinct axes of the grid" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+		}
+		
+		isIntegrationAxis[i_axis] = true;
+	}
+	
+	std::vector<std::size_t> shape;
 	
 	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
-		const std::size_t axisPoint = gridPoint[i_axis];
+		shape.push_back(CoordAxes[i_axis]->point_number());
+	}
+	
+	std::vector<double> values;
+	
+	bool isContracted = false;	// the first contraction reads the stored function values directly, all further ones the intermediate results in 'double' precision
+	
+	for ( std::size_t i_axis_reverse = 1; i_axis_reverse <= Dim; ++i_axis_reverse )	// integrate out the axes in reverse order, such that the indices of the axes yet to be integrated out are not affected by the removal of the others
+	{
+		const std::size_t i_axis = Dim - i_axis_reverse;
 		
-		const CoordinateAxis* axis = CoordAxes[i_axis];
+		if ( isIntegrationAxis[i_axis] )
+		{
+			if ( isContracted )
+			{
+				values = contract_axis(values.data(), shape, i_axis, axis_integration_weights(i_axis), schedule);
+			}
+			else
+			{
+				values = contract_axis(FunctionValues.data(), shape, i_axis, axis_integration_weights(i_axis), schedule);
+				
+				isContracted = true;
+			}
+		}
+	}
+	
+	SharedCoordinateAxisPointers<ReducedDim> remainingCoordAxes;
+	
+	std::size_t i_remainingAxis = 0;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		if ( !isIntegrationAxis[i_axis] )
+		{
+			remainingCoordAxes[i_remainingAxis] = CoordAxes[i_axis];
+			
+			++i_remainingAxis;
+		}
+	}
+	
+	return GridFunction<ReducedDim, Value>(remainingCoordAxes, std::vector<Value>(values.begin(), values.end()));	// the remaining axes are shared with the new grid function
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::write_to_file (const std::string& fileName) const
+{
+	if ( Layout != StorageLayout::RowMajor )	// grid function files always contain the function values in the nested fashion
+	{
+		with_storage_layout(StorageLayout::RowMajor).write_to_file(fileName);
 		
-		weights[i_axis] = axis->integration_weight_unchecked(axisPoint);	// read off the integration weight of the corresponding axis point
+		return;
 	}
 	
-	return weights;
+	write_grid_function_file(fileName, this->axis_descriptions(), FunctionValues.data(), FunctionValueTypeOf<Value>::Type, sizeof(Value), GridPointNumber);
 }
 
-template <std::size_t Dim>
-MultiDimGrid::DoubleArray<Dim> MultiDimGrid::GridFunction<Dim>::integration_weights_at_index (const std::size_t index) const
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value> MultiDimGrid::GridFunction<Dim, Value>::publish_to_shared_memory (const std::string& segmentName) const
 {
-	check_index(index, "integration_weight_at_index");
+	if ( Layout != StorageLayout::RowMajor )	// grid function segments always contain the function values in the nested fashion
+	{
+		return with_storage_layout(StorageLayout::RowMajor).publish_to_shared_memory(segmentName);
+	}
 	
-	return integration_weights_at_index_unchecked(index);
+	return GridFunction( publish_grid_function_segment(segmentName, this->axis_descriptions(), FunctionValues.data(), FunctionValueTypeOf<Value>::Type, sizeof(Value), GridPointNumber) );
+}
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value> MultiDimGrid::GridFunction<Dim, Value>::attach_to_shared_memory (const std::string& segmentName)
+{
+	return GridFunction( attach_grid_function_segment(segmentName) );
 }
 
-template <std::size_t Dim>
-MultiDimGrid::DoubleArray<Dim> MultiDimGrid::GridFunction<Dim>::integration_weights_at_index_unchecked (const std::size_t index) const
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value> MultiDimGrid::GridFunction<Dim, Value>::refine (const IntegerArray<Dim>& refinementFactors, const Function<Dim>& func, const ParallelSchedule schedule) const
 {
-	DoubleArray<Dim> weights;
+	SharedCoordinateAxisPointers<Dim> refinedCoordAxes;
 	
-	std::size_t reducedIndex = index;
+	std::size_t refinedGridPointNumber = 1;
 	
-	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// if the index is divided by the outermost (i_axis=0) stride, the result is given by the value of the outermost axis point plus a rest that is smaller than one, but integer division in C++ omits this rest automatically; if one then subtracts the product of this axis point value and its stride to get an reduced index, this procedure can be repeated for the inner axes
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
-		const std::size_t stride = IndexStrides[i_axis];
+		refinedCoordAxes[i_axis].reset( create_refined_coordinate_axis(*CoordAxes[i_axis], refinementFactors[i_axis]) );
 		
-		const std::size_t axisPoint = reducedIndex / stride;
-		
-		const CoordinateAxis* axis = CoordAxes[i_axis];
+		refinedGridPointNumber *= refinedCoordAxes[i_axis]->point_number();
+	}
+	
+	GridFunction refinedGridFunction(refinedCoordAxes, FunctionValueBuffer<Value>(refinedGridPointNumber, FunctionValues.storage_policy()));	// the uninitialized function values are first written by the loop below
+	
+	const IntegerArray<Dim> refinedIndexStrides = refinedGridFunction.index_strides();
+	
+	parallel_for(refinedGridPointNumber, schedule, [&] (const std::size_t refinedIndex)
+	{
+		std::size_t index = 0;
+		std::size_t remainingIndex = refinedIndex;
+		bool isCoarseGridPoint = true;
 		
-		weights[i_axis] = axis->integration_weight_unchecked(axisPoint);	// read off the integration weight of the corresponding axis point
+		for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// the refined grid point coincides with a coarse one if its axis points along all axes are multiples of the refinement factors
+		{
+			const std::size_t refinedAxisPoint = remainingIndex / refinedIndexStrides[i_axis];
+			
+			remainingIndex %= refinedIndexStrides[i_axis];
+			
+			if ( refinedAxisPoint % refinementFactors[i_axis] != 0 )
+			{
+				isCoarseGridPoint = false;
+				
+				break;
+			}
+			
+			index += (refinedAxisPoint / refinementFactors[i_axis]) * IndexStrides[i_axis];
+		}
 		
-		reducedIndex -= axisPoint * stride;
-	}
+		if ( isCoarseGridPoint )
+		{
+			refinedGridFunction.FunctionValues[refinedIndex] = value_at_index_unchecked(index);
+		}
+		else
+		{
+			refinedGridFunction.FunctionValues[refinedIndex] = refinedGridFunction.instrumented_evaluation( func, refinedGridFunction.coordinates_at_index_unchecked(refinedIndex) );
+		}
+	});
 	
-	return weights;
+	return refinedGridFunction;
 }
 
-template <std::size_t Dim>
-double& MultiDimGrid::GridFunction<Dim>::value (const GridPoint<Dim>& gridPoint)
+template <std::size_t Dim, class Value>
+MultiDimGrid::RefinementErrorEstimate<Dim> MultiDimGrid::GridFunction<Dim, Value>::refinement_error_estimate (const GridFunction& refinedGridFunction, const ParallelSchedule schedule) const
 {
-	std::size_t index = 0;
+	IntegerArray<Dim> refinementFactors;
 	
 	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
-		const std::size_t axisPoint = gridPoint[i_axis];
+		const AxisDescription axisDescription = CoordAxes[i_axis]->description();
+		const AxisDescription refinedAxisDescription = refinedGridFunction.CoordAxes[i_axis]->description();
 		
-		const CoordinateAxis* axis = CoordAxes[i_axis];
+		if ( (axisDescription.Type == AxisType::Custom) || (refinedAxisDescription.Type == AxisType::Custom) )	// custom axes can not be compared by their descriptions
+		{
+			std::cout << std::endl
+					  << " MultiDimGrid::GridFunction::refinement_error_estimate Error: Custom coordinate axes are not supported" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+		}
 		
-		check_axis_point(axisPoint, axis, "value");
+		const std::size_t intervalNumber = axisDescription.IntervalNumber;
+		const std::size_t refinedIntervalNumber = refinedAxisDescription.IntervalNumber;
 		
-		index += axisPoint * IndexStrides[i_axis];	// the index associated to a grid point is found by multiplying all its individual axis point numbers with their corresponding index stride values and summing up the results
+		const bool isRefinement = (intervalNumber == 0) ? (refinedIntervalNumber == 0) : (refinedIntervalNumber % intervalNumber == 0);
+		const bool isSameAxis = (axisDescription.Type == refinedAxisDescription.Type) && (axisDescription.LowerCoordinateLimit == refinedAxisDescription.LowerCoordinateLimit) && (axisDescription.UpperCoordinateLimit == refinedAxisDescription.UpperCoordinateLimit);
+		
+		if ( !isRefinement || !isSameAxis )
+		{
+			std::cout << std::endl
+					  << " MultiDimGrid::GridFunction::refinement_error_estimate Error: Grid function is not a refinement of this one" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+		}
+		
+		refinementFactors[i_axis] = (intervalNumber == 0) ? 1 : (refinedIntervalNumber / intervalNumber);
 	}
 	
-	return FunctionValues[index];
+	const IntegerArray<Dim> refinedIndexStrides = refinedGridFunction.index_strides();
+	const std::size_t sliceNumber = refinedGridFunction.CoordAxes[0]->point_number();	// the refined grid points are split into slices along the outermost axis, whose maximum errors are reduced afterwards
+	
+	std::vector<RefinementErrorEstimate<Dim>> sliceErrorEstimates(sliceNumber);
+	
+	parallel_for(sliceNumber, schedule, [&] (const std::size_t i_slice)
+	{
+		RefinementErrorEstimate<Dim>& sliceErrorEstimate = sliceErrorEstimates[i_slice];
+		
+		sliceErrorEstimate.MaximumError = 0.0;
+		sliceErrorEstimate.AxisMaximumErrors.fill(0.0);
+		
+		const std::size_t i_firstRefinedIndex = i_slice * refinedIndexStrides[0];
+		
+		for ( std::size_t refinedIndex = i_firstRefinedIndex; refinedIndex < i_firstRefinedIndex + refinedIndexStrides[0]; ++refinedIndex )
+		{
+			std::size_t remainingIndex = refinedIndex;
+			std::size_t refinedAxisNumber = 0;	// number of axes along which the refined grid point does not coincide with a coarse one
+			std::size_t i_refinedAxis = 0;
+			
+			for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+			{
+				const std::size_t refinedAxisPoint = remainingIndex / refinedIndexStrides[i_axis];
+				
+				remainingIndex %= refinedIndexStrides[i_axis];
+				
+				if ( refinedAxisPoint % refinementFactors[i_axis] != 0 )
+				{
+					++refinedAxisNumber;
+					
+					i_refinedAxis = i_axis;
+				}
+			}
+			
+			if ( refinedAxisNumber == 0 )	// the interpolation is exact at coarse grid points
+			{
+				continue;
+			}
+			
+			const double error = std::fabs( refinedGridFunction.value_at_index_unchecked(refinedIndex) - interpolate_unchecked(refinedGridFunction.coordinates_at_index_unchecked(refinedIndex)) );
+			
+			if ( error > sliceErrorEstimate.MaximumError )
+			{
+				sliceErrorEstimate.MaximumError = error;
+			}
+			
+			if ( (refinedAxisNumber == 1) && (error > sliceErrorEstimate.AxisMaximumErrors[i_refinedAxis]) )
+			{
+				sliceErrorEstimate.AxisMaximumErrors[i_refinedAxis] = error;
+			}
+		}
+	});
+	
+	RefinementErrorEstimate<Dim> errorEstimate;
+	
+	errorEstimate.MaximumError = 0.0;
+	errorEstimate.AxisMaximumErrors.fill(0.0);
+	
+	for ( const RefinementErrorEstimate<Dim>& sliceErrorEstimate : sliceErrorEstimates )
+	{
+		errorEstimate.MaximumError = std::max(errorEstimate.MaximumError, sliceErrorEstimate.MaximumError);
+		
+		for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+		{
+			errorEstimate.AxisMaximumErrors[i_axis] = std::max(errorEstimate.AxisMaximumErrors[i_axis], sliceErrorEstimate.AxisMaximumErrors[i_axis]);
+		}
+	}
+	
+	return errorEstimate;
 }
 
-template <std::size_t Dim>
-const double& MultiDimGrid::GridFunction<Dim>::value (const GridPoint<Dim>& gridPoint) const
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value> MultiDimGrid::GridFunction<Dim, Value>::regrid (const CoordinateAxisPointers<Dim>& newCoordAxisPointers, const ParallelSchedule schedule) const
 {
-	std::size_t index = 0;
+	if ( Layout != StorageLayout::RowMajor )	// the axis interpolations rely on the nested storage of the function values
+	{
+		return with_storage_layout(StorageLayout::RowMajor, schedule).regrid(newCoordAxisPointers, schedule);
+	}
+	
+	SharedCoordinateAxisPointers<Dim> newCoordAxes;
+	
+	std::array<std::vector<AxisLocation>, Dim> axisLocations;	// the locations of the new axis points on the old axes define the non-zero elements of the sparse interpolation matrices
+	std::array<std::size_t, Dim> axisOrder;
 	
 	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
-		const std::size_t axisPoint = gridPoint[i_axis];
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
 		
-		const CoordinateAxis* axis = CoordAxes[i_axis];
+		newCoordAxes[i_axis].reset( newCoordAxisPointers[i_axis]->clone() );
 		
-		check_axis_point(axisPoint, axis, "value");
+		const CoordinateAxis* newAxis = newCoordAxes[i_axis].get();
 		
-		index += axisPoint * IndexStrides[i_axis];	// the index associated to a grid point is found by multiplying all its individual axis point numbers with their corresponding index stride values and summing up the results
+		if ( (newAxis->lower_coordinate_limit() < axis->lower_coordinate_limit()) || (newAxis->upper_coordinate_limit() > axis->upper_coordinate_limit()) )
+		{
+			std::cout << std::endl
+					  << " MultiDimGrid::GridFunction::regrid Error: Coordinate axes not within range of grid" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+		}
+		
+		for ( std::size_t i_newAxisPoint = 0; i_newAxisPoint < newAxis->point_number(); ++i_newAxisPoint )
+		{
+			const double coord = std::min(std::max(newAxis->coordinate_unchecked(i_newAxisPoint), axis->lower_coordinate_limit()), axis->upper_coordinate_limit());	// rounding errors in the coordinates of the new axis points must not carry them out of the range of the old axis
+			
+			AxisLocation location;
+			
+			location.LowerAxisPoint = locate_cell_axis_point(i_axis, coord, location.InterpolationWeight);
+			location.HigherAxisPoint = (axis->point_number() > 1) ? (location.LowerAxisPoint + 1) : location.LowerAxisPoint;
+			
+			axisLocations[i_axis].push_back(location);
+		}
+		
+		axisOrder[i_axis] = i_axis;
 	}
 	
-	return FunctionValues[index];
-}
-
-template <std::size_t Dim>
-double& MultiDimGrid::GridFunction<Dim>::value_unchecked (const GridPoint<Dim>& gridPoint)
-{
-	std::size_t index = 0;
+	std::sort(axisOrder.begin(), axisOrder.end(), [&] (const std::size_t i_axis, const std::size_t i_otherAxis)	// the axes are interpolated in the order of increasing ratio of new to old axis points, which keeps the intermediate results as small as possible
+	{
+		return axisLocations[i_axis].size() * CoordAxes[i_otherAxis]->point_number() < axisLocations[i_otherAxis].size() * CoordAxes[i_axis]->point_number();
+	});
+	
+	std::vector<std::size_t> shape;
+	
+	std::size_t newGridPointNumber = 1;
+	std::size_t intermediateValueNumber = 0;	// maximum number of intermediate function values after any but the last interpolation
 	
 	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
-		const std::size_t axisPoint = gridPoint[i_axis];
+		shape.push_back(CoordAxes[i_axis]->point_number());
+	}
+	
+	std::size_t valueNumber = GridPointNumber;
+	
+	for ( std::size_t i_pass = 0; i_pass + 1 < Dim; ++i_pass )
+	{
+		valueNumber = valueNumber / CoordAxes[axisOrder[i_pass]]->point_number() * axisLocations[axisOrder[i_pass]].size();
 		
-		index += axisPoint * IndexStrides[i_axis];	// the index associated to a grid point is found by multiplying all its individual axis point numbers with their corresponding index stride values and summing up the results
+		intermediateValueNumber = std::max(intermediateValueNumber, valueNumber);
+	}
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		newGridPointNumber *= axisLocations[i_axis].size();
 	}
 	
-	return FunctionValues[index];
+	FunctionValueBuffer<Value> newFuncValues(newGridPointNumber, FunctionValues.storage_policy());	// the uninitialized function values are first written by the last axis interpolation
+	
+	if ( Dim == 1 )
+	{
+		interpolate_axis(FunctionValues.data(), newFuncValues.data(), shape, 0, axisLocations[0], schedule);
+	}
+	else	// the first interpolation reads the stored function values and the last one writes the new ones directly, while the intermediate results in 'double' precision alternate between two buffers
+	{
+		std::array<std::vector<double>, 2> intermediateValues;
+		
+		intermediateValues[0].resize(intermediateValueNumber);
+		intermediateValues[1].resize((Dim > 2) ? intermediateValueNumber : 0);
+		
+		interpolate_axis(FunctionValues.data(), intermediateValues[0].data(), shape, axisOrder[0], axisLocations[axisOrder[0]], schedule);
+		
+		for ( std::size_t i_pass = 1; i_pass + 1 < Dim; ++i_pass )
+		{
+			interpolate_axis(intermediateValues[(i_pass - 1) % 2].data(), intermediateValues[i_pass % 2].data(), shape, axisOrder[i_pass], axisLocations[axisOrder[i_pass]], schedule);
+		}
+		
+		interpolate_axis(intermediateValues[Dim % 2].data(), newFuncValues.data(), shape, axisOrder[Dim - 1], axisLocations[axisOrder[Dim - 1]], schedule);
+	}
+	
+	return GridFunction(newCoordAxes, std::move(newFuncValues));
 }
 
-template <std::size_t Dim>
-const double& MultiDimGrid::GridFunction<Dim>::value_unchecked (const GridPoint<Dim>& gridPoint) const
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value> MultiDimGrid::GridFunction<Dim, Value>::with_storage_layout (const StorageLayout layout, const ParallelSchedule schedule) const
 {
-	std::size_t index = 0;
+	GridFunction relaidGridFunction(CoordAxes, layout, FunctionValues.storage_policy());
 	
-	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	parallel_for(GridPointNumber, schedule, [this, &relaidGridFunction] (const std::size_t index)
 	{
-		const std::size_t axisPoint = gridPoint[i_axis];
+		relaidGridFunction.FunctionValues[relaidGridFunction.storage_index(index)] = FunctionValues[storage_index(index)];
+	});
+	
+	return relaidGridFunction;
+}
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::StorageLayout MultiDimGrid::GridFunction<Dim, Value>::storage_layout () const
+{
+	return Layout;
+}
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value> MultiDimGrid::GridFunction<Dim, Value>::with_storage_policy (const StoragePolicy& policy, const ParallelSchedule schedule) const
+{
+	GridFunction reallocatedGridFunction(CoordAxes, Layout, policy);
+	
+	parallel_for(GridPointNumber, schedule, [this, &reallocatedGridFunction] (const std::size_t index)	// both grid functions have the same storage positions, but only those of grid points are copied, as the gaps of incomplete tiles are never initialized
+	{
+		const std::size_t storageIndex = storage_index(index);
 		
-		index += axisPoint * IndexStrides[i_axis];	// the index associated to a grid point is found by multiplying all its individual axis point numbers with their corresponding index stride values and summing up the results
-	}
+		reallocatedGridFunction.FunctionValues[storageIndex] = FunctionValues[storageIndex];
+	});
 	
-	return FunctionValues[index];
+	return reallocatedGridFunction;
 }
 
-template <std::size_t Dim>
-double& MultiDimGrid::GridFunction<Dim>::operator[] (const GridPoint<Dim>& gridPoint)
+template <std::size_t Dim, class Value>
+bool MultiDimGrid::GridFunction<Dim, Value>::is_read_only () const
 {
-	return value(gridPoint);
+	return FunctionValues.is_read_only();
 }
 
-template <std::size_t Dim>
-const double& MultiDimGrid::GridFunction<Dim>::operator[] (const GridPoint<Dim>& gridPoint) const
+template <std::size_t Dim, class Value>
+MultiDimGrid::StoragePolicy MultiDimGrid::GridFunction<Dim, Value>::storage_policy () const
 {
-	return value(gridPoint);
+	return FunctionValues.storage_policy();
 }
 
-template <std::size_t Dim>
-double& MultiDimGrid::GridFunction<Dim>::value_at_index (const std::size_t index)
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunctionCounters MultiDimGrid::GridFunction<Dim, Value>::instrumentation_counters () const
 {
-	check_index(index, "value_at_index");
+	GridFunctionCounters counters;
 	
-	return value_at_index_unchecked(index);
+	counters.Interpolations = Counters.total(InterpolationCounter);
+	counters.CheckedInterpolations = Counters.total(CheckedInterpolationCounter);
+	counters.FunctionEvaluations = Counters.total(FunctionEvaluationCounter);
+	counters.FunctionEvaluationTime = 1.0e-9 * Counters.total(FunctionEvaluationTimeCounter);
+	
+	for ( const std::uint64_t slotConstructionTime : Counters.slot_values(ConstructionTimeCounter) )
+	{
+		counters.ThreadConstructionTimes.push_back(1.0e-9 * slotConstructionTime);
+	}
+	
+	counters.AllocatedBytes = FunctionValues.is_external() ? 0 : (FunctionValues.size() * sizeof(Value));
+	
+	for ( const std::vector<std::size_t>& axisOffsets : AxisStorageOffsets )
+	{
+		counters.AllocatedBytes += axisOffsets.capacity() * sizeof(std::size_t);
+	}
+	
+	return counters;
 }
 
-template <std::size_t Dim>
-const double& MultiDimGrid::GridFunction<Dim>::value_at_index (const std::size_t index) const
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::reset_instrumentation_counters () const
 {
-	check_index(index, "value_at_index");
-	
-	return value_at_index_unchecked(index);
+	Counters.reset();
 }
 
-template <std::size_t Dim>
-double& MultiDimGrid::GridFunction<Dim>::value_at_index_unchecked (const std::size_t index)
+template <std::size_t Dim, class Value>
+template <class Body>
+void MultiDimGrid::GridFunction<Dim, Value>::for_each_value (const Body& body, const ParallelSchedule schedule)
 {
-	return FunctionValues[index];
+	for_each_value(this->grid_point_range(), body, schedule);
 }
 
-template <std::size_t Dim>
-const double& MultiDimGrid::GridFunction<Dim>::value_at_index_unchecked (const std::size_t index) const
+template <std::size_t Dim, class Value>
+template <class Body>
+void MultiDimGrid::GridFunction<Dim, Value>::for_each_value (const Body& body, const ParallelSchedule schedule) const
 {
-	return FunctionValues[index];
+	for_each_value(this->grid_point_range(), body, schedule);
 }
 
-template <std::size_t Dim>
-double MultiDimGrid::GridFunction<Dim>::interpolate (const Coordinates<Dim>& coords) const
+template <std::size_t Dim, class Value>
+template <class Body>
+void MultiDimGrid::GridFunction<Dim, Value>::for_each_value (const GridPointRange<Dim>& range, const Body& body, const ParallelSchedule schedule)
 {
-	const GridPoint<Dim> gridPoint = {};
+	check_writable("GridFunction::for_each_value");
 	
-	return internal_recursive_interpolation(coords, gridPoint, Dim);	// to interpolate the grid function, one has to average over its values at all the 2^'Dim' grid points nearest to 'coords', using the appropriate interpolation weights; these points and the weights are constructed recursively, starting from an initial default point 'gridPoint'
+	this->for_each_point(range, [this, &body] (const GridPointVisit<Dim>& visit)
+	{
+		body(visit, FunctionValues[storage_index(visit)]);
+	}, schedule);
 }
 
-template <std::size_t Dim>
-double MultiDimGrid::GridFunction<Dim>::interpolate_unchecked (const Coordinates<Dim>& coords) const
+template <std::size_t Dim, class Value>
+template <class Body>
+void MultiDimGrid::GridFunction<Dim, Value>::for_each_value (const GridPointRange<Dim>& range, const Body& body, const ParallelSchedule schedule) const
 {
-	const GridPoint<Dim> gridPoint = {};
+	this->for_each_point(range, [this, &body] (const GridPointVisit<Dim>& visit)
+	{
+		body(visit, FunctionValues[storage_index(visit)]);
+	}, schedule);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::gather_cell_corner_values (const GridPoint<Dim>& cellAxisPoints, double* cornerValues) const
+{
+	if ( Layout == StorageLayout::RowMajor )
+	{
+		std::size_t cellIndex = 0;
+		
+		for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+		{
+			cellIndex += cellAxisPoints[i_axis] * IndexStrides[i_axis];
+		}
+		
+		for ( std::size_t i_corner = 0; i_corner < CornerNumber; ++i_corner )	// the indices of the corners follow from the index of the lowest one by adding the precomputed corner offsets
+		{
+			cornerValues[i_corner] = FunctionValues[cellIndex + CornerOffsets[i_corner]];	// the function values are widened to 'double' precision before being interpolated
+		}
+		
+		return;
+	}
+	
+	std::array<std::size_t, CornerNumber> cornerIndices;
+	
+	cornerIndices[0] = 0;
+	
+	std::size_t cornerNumber = 1;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// the storage positions of the corners are sums of the offsets of the lower or higher axis point along each axis; every axis doubles the number of corners, with the innermost axis ending up in the lowest bit of the corner number
+	{
+		const std::vector<std::size_t>& axisOffsets = AxisStorageOffsets[i_axis];
+		
+		const std::size_t lowerAxisPoint = cellAxisPoints[i_axis];
+		const std::size_t higherAxisPoint = (axisOffsets.size() > 1) ? (lowerAxisPoint + 1) : lowerAxisPoint;
+		
+		for ( std::size_t i_corner = cornerNumber; i_corner-- > 0; )
+		{
+			const std::size_t cornerIndex = cornerIndices[i_corner];
+			
+			cornerIndices[2 * i_corner] = cornerIndex + axisOffsets[lowerAxisPoint];
+			cornerIndices[2 * i_corner + 1] = cornerIndex + axisOffsets[higherAxisPoint];
+		}
+		
+		cornerNumber *= 2;
+	}
 	
-	return internal_recursive_interpolation_unchecked(coords, gridPoint, Dim);	// to interpolate the grid function, one has to average over its values at all the 2^'Dim' grid points nearest to 'coords', using the appropriate interpolation weights; these points and the weights are constructed recursively, starting from an initial default point 'gridPoint'
+	for ( std::size_t i_corner = 0; i_corner < CornerNumber; ++i_corner )
+	{
+		cornerValues[i_corner] = FunctionValues[cornerIndices[i_corner]];
+	}
 }
 
-template <std::size_t Dim>
-double MultiDimGrid::GridFunction<Dim>::operator() (const Coordinates<Dim>& coords) const
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const SharedCoordinateAxisPointers<Dim>& sharedCoordAxes, FunctionValueBuffer<Value>&& funcValues) :
+	CoordinateGrid<Dim>(sharedCoordAxes),
+	Layout(StorageLayout::RowMajor),
+	AxisStorageOffsets(),
+	FunctionValues(std::move(funcValues))
 {
-	return interpolate(coords);
+	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
 }
 
-template <std::size_t Dim>
-MultiDimGrid::IntegerArray<Dim> MultiDimGrid::GridFunction<Dim>::index_strides () const
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (GridFunctionFileContent&& fileContent) :
+	CoordinateGrid<Dim>(fileContent.AxisDescriptions),
+	Layout(StorageLayout::RowMajor),
+	AxisStorageOffsets(),
+	FunctionValues(mapped_function_values(fileContent))
 {
-	return IndexStrides;
+	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
+	
+	check_function_value_number();
 }
 
-template <std::size_t Dim>
-double MultiDimGrid::GridFunction<Dim>::point_number () const
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value>::GridFunction (const SharedCoordinateAxisPointers<Dim>& sharedCoordAxes, const StorageLayout layout, const StoragePolicy& policy) :
+	CoordinateGrid<Dim>(sharedCoordAxes),
+	Layout(layout),
+	AxisStorageOffsets(compute_axis_storage_offsets(layout)),
+	FunctionValues(storage_value_number(), policy)
 {
-	return GridPointNumber;
+	static_assert(Dim != 0, "MultiDimGrid::GridFunction Error: Number of dimensions is zero");
 }
 
-template <std::size_t Dim>
-MultiDimGrid::GridFunction<Dim>& MultiDimGrid::GridFunction<Dim>::operator= (const GridFunction& otherGridFunction)
+template <std::size_t Dim, class Value>
+MultiDimGrid::FunctionValueBuffer<Value> MultiDimGrid::GridFunction<Dim, Value>::mapped_function_values (const GridFunctionFileContent& fileContent)
 {
-	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// iterate through the different coordinate axes and assign each of them to the corresponding axis of 'otherGridFunction'
+	if ( (fileContent.ValueType != FunctionValueTypeOf<Value>::Type) || (fileContent.ValueSize != sizeof(Value)) )
 	{
-		CoordAxes[i_axis] = otherGridFunction.CoordAxes[i_axis]->clone();
+		std::cout << std::endl
+				  << " MultiDimGrid::GridFunction Error: Type of function values in grid function file does not match value type" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
 	}
 	
-	IndexStrides = otherGridFunction.IndexStrides;
-	GridPointNumber = otherGridFunction.GridPointNumber;
-	FunctionValues = otherGridFunction.FunctionValues;
-	
-	return *this;
+	return FunctionValueBuffer<Value>(static_cast<Value*>(fileContent.Values), fileContent.ValueNumber, fileContent.Mapping, fileContent.IsReadOnly);
 }
 
-template <std::size_t Dim>
-MultiDimGrid::GridFunction<Dim>::~GridFunction ()
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::check_function_value_number () const
 {
-	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// iterate through the different coordinate axes and delete each of them
+	if ( FunctionValues.size() != GridPointNumber )
 	{
-		delete CoordAxes[i_axis];
+		std::cout << std::endl
+				  << " MultiDimGrid::GridFunction Error: Number of function values does not match number of grid points" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
 	}
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-// protected
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::check_writable (const char* location) const
+{
+	if ( FunctionValues.is_read_only() )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::" + std::string(location) + " Error: Function values are read-only" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+}
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-// private
+template <std::size_t Dim, class Value>
+template <class Evaluation>
+void MultiDimGrid::GridFunction<Dim, Value>::evaluate_function_values (const Evaluation& evaluation, const ParallelSchedule schedule)
+{
+	const auto evaluate_at_point = [this, &evaluation] (const GridPointVisit<Dim>& visit)	// every grid point is handled independently, i.e. 'evaluation' is evaluated at its coordinates, so the distribution of the grid points among threads does not affect the results
+	{
+		#ifdef MULTIDIMGRID_INSTRUMENTATION
+		const std::uint64_t startTime = instrumentation_time();
+		#endif
+		
+		FunctionValues[visit.Index] = instrumented_evaluation(evaluation, visit.Coords);
+		
+		#ifdef MULTIDIMGRID_INSTRUMENTATION
+		Counters.add(ConstructionTimeCounter, instrumentation_time() - startTime);
+		#endif
+	};
+	
+	this->for_each_point(evaluate_at_point, schedule);
+}
+
+template <std::size_t Dim, class Value>
+template <class BatchEvaluation>
+void MultiDimGrid::GridFunction<Dim, Value>::evaluate_function_value_batches (const BatchEvaluation& batchEvaluation, const ParallelSchedule schedule)
+{
+	std::array<std::vector<double>, Dim> axisCoords;	// the coordinates of the axis points are obtained from the axes once in advance
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		axisCoords[i_axis] = axis_coordinates(i_axis);
+	}
+	
+	const std::size_t rowLength = axisCoords[Dim - 1].size();	// number of grid points in a row along the innermost axis
+	const std::size_t rowNumber = GridPointNumber / rowLength;
+	
+	const std::size_t batchRowNumber = (rowLength < BatchEvaluationSize) ? (BatchEvaluationSize / rowLength) : 1;						// a batch either consists of as many whole rows as fit into it...
+	const std::size_t rowBatchNumber = (rowLength < BatchEvaluationSize) ? 1 : ((rowLength + BatchEvaluationSize - 1) / BatchEvaluationSize);	// ...or of a part of a single row, in which case each row is split into several batches
+	const std::size_t batchNumber = (rowNumber + batchRowNumber - 1) / batchRowNumber * rowBatchNumber;
+	
+	parallel_for(batchNumber, schedule, [&] (const std::size_t i_batch)
+	{
+		const std::size_t i_firstRow = (i_batch / rowBatchNumber) * batchRowNumber;
+		const std::size_t endRow = (i_firstRow + batchRowNumber < rowNumber) ? (i_firstRow + batchRowNumber) : rowNumber;
+		
+		const std::size_t i_firstRowPoint = (i_batch % rowBatchNumber) * BatchEvaluationSize;
+		const std::size_t endRowPoint = (i_firstRowPoint + BatchEvaluationSize < rowLength) ? (i_firstRowPoint + BatchEvaluationSize) : rowLength;
+		
+		std::array<double, Dim * BatchEvaluationSize> batchCoords;	// coordinates of the grid points in the batch, stored axis by axis
+		std::array<double, BatchEvaluationSize> batchValues;
+		
+		std::size_t batchLength = 0;
+		
+		for ( std::size_t i_row = i_firstRow; i_row < endRow; ++i_row )	// the grid points of a row only differ in their innermost axis point, so the axis points along the outer axes are determined once per row
+		{
+			std::size_t remainingIndex = i_row * rowLength;
+			
+			for ( std::size_t i_axis = 0; i_axis < Dim - 1; ++i_axis )
+			{
+				const std::size_t axisPoint = remainingIndex / IndexStrides[i_axis];
+				
+				remainingIndex -= axisPoint * IndexStrides[i_axis];
+				
+				std::fill_n(&batchCoords[i_axis * BatchEvaluationSize + batchLength], endRowPoint - i_firstRowPoint, axisCoords[i_axis][axisPoint]);
+			}
+			
+			std::copy(&axisCoords[Dim - 1][i_firstRowPoint], &axisCoords[Dim - 1][0] + endRowPoint, &batchCoords[(Dim - 1) * BatchEvaluationSize + batchLength]);
+			
+			batchLength += endRowPoint - i_firstRowPoint;
+		}
+		
+		CoordinateArrays<Dim> coordArrays;
+		
+		for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+		{
+			coordArrays[i_axis] = &batchCoords[i_axis * BatchEvaluationSize];
+		}
+		
+		#ifdef MULTIDIMGRID_INSTRUMENTATION
+		const std::uint64_t startTime = instrumentation_time();
+		#endif
+		
+		batchEvaluation(coordArrays, batchValues.data(), batchLength);
+		
+		#ifdef MULTIDIMGRID_INSTRUMENTATION
+		const std::uint64_t evaluationTime = instrumentation_time() - startTime;
+		
+		Counters.add(FunctionEvaluationCounter, batchLength);
+		Counters.add(FunctionEvaluationTimeCounter, evaluationTime);
+		Counters.add(ConstructionTimeCounter, evaluationTime);
+		#endif
+		
+		const std::size_t i_firstIndex = i_firstRow * rowLength + i_firstRowPoint;	// the grid points of the batch have consecutive indices
+		
+		for ( std::size_t i_batchPoint = 0; i_batchPoint < batchLength; ++i_batchPoint )
+		{
+			FunctionValues[i_firstIndex + i_batchPoint] = batchValues[i_batchPoint];
+		}
+	});
+}
 
-template <std::size_t Dim>
-MultiDimGrid::CoordinateAxisPointers<Dim> MultiDimGrid::GridFunction<Dim>::copy_coordinate_axes (const MultiDimGrid::CoordinateAxisPointers<Dim>& coordAxisPointers) const
+template <std::size_t Dim, class Value>
+template <class Evaluation>
+double MultiDimGrid::GridFunction<Dim, Value>::instrumented_evaluation (const Evaluation& evaluation, const Coordinates<Dim>& coords) const
 {
-	CoordinateAxisPointers<Dim> coordAxes;
+	#ifdef MULTIDIMGRID_INSTRUMENTATION
+	const std::uint64_t startTime = instrumentation_time();
 	
-	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// iterate through the different coordinate axes and copy them using the 'CoordinateAxis::clone' method
+	const double value = evaluation(coords);
+	
+	Counters.add(FunctionEvaluationTimeCounter, instrumentation_time() - startTime);
+	Counters.add(FunctionEvaluationCounter, 1);
+	
+	return value;
+	#else
+	return evaluation(coords);
+	#endif
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::GridFunction<Dim, Value>::gather_corner_values (const Coordinates<Dim>& coords, DoubleArray<Dim>& interpolationWeights, double* cornerValues) const
+{
+	GridPoint<Dim> cellAxisPoints;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
-		coordAxes[i_axis] = coordAxisPointers[i_axis]->clone();
+		cellAxisPoints[i_axis] = locate_cell_axis_point(i_axis, coords[i_axis], interpolationWeights[i_axis]);
 	}
 	
-	return coordAxes;
+	gather_cell_corner_values(cellAxisPoints, cornerValues);
 }
 
-template <std::size_t Dim>
-MultiDimGrid::IntegerArray<Dim> MultiDimGrid::GridFunction<Dim>::compute_index_strides (const MultiDimGrid::CoordinateAxisPointers<Dim>& coordAxisPointers) const
+template <std::size_t Dim, class Value>
+std::size_t MultiDimGrid::GridFunction<Dim, Value>::storage_index (const std::size_t index) const
 {
-	IntegerArray<Dim> indexStrides;
+	if ( Layout == StorageLayout::RowMajor )
+	{
+		return index;
+	}
 	
-	indexStrides[Dim-1] = 1;	// stride of the innermost coordinate in the nested 1-dimensional storage is '1'
+	std::size_t storageIndex = 0;
+	std::size_t remainingIndex = index;
 	
-	for ( std::size_t i_axis_reverse = 2; i_axis_reverse <= Dim; ++i_axis_reverse )	// iterate through the remaining coordinate axes in reverse order
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
 	{
-		const std::size_t i_axis = Dim - i_axis_reverse;
+		storageIndex += AxisStorageOffsets[i_axis][remainingIndex / IndexStrides[i_axis]];
 		
-		indexStrides[i_axis] = indexStrides[i_axis + 1] * coordAxisPointers[i_axis + 1]->point_number();	// the corresponding strides are found iteratively: the stride of any coordinate is given by the stride of the coordinate one nesting level deeper times the number of points of that cordinate's axis
+		remainingIndex %= IndexStrides[i_axis];
 	}
 	
-	return indexStrides;
+	return storageIndex;
 }
 
-template <std::size_t Dim>
-double MultiDimGrid::GridFunction<Dim>::internal_recursive_interpolation (const Coordinates<Dim>& coords, const GridPoint<Dim>& gridPoint, const std::size_t i_axis) const
+template <std::size_t Dim, class Value>
+std::size_t MultiDimGrid::GridFunction<Dim, Value>::storage_index (const GridPointVisit<Dim>& visit) const
 {
-	if ( i_axis > 0 )	// all the neighbouring grid points of 'coords' are constructed by recursively building up a binary tree with each recursion/branching level corresponding to one of the 'Dim' axes
+	if ( Layout == StorageLayout::RowMajor )
 	{
-		const std::size_t i_nextAxis = i_axis - 1;
-		
-		const double coord = coords[i_nextAxis];
-		
-		const CoordinateAxis* axis = CoordAxes[i_nextAxis];
+		return visit.Index;
+	}
+	
+	std::size_t storageIndex = 0;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		storageIndex += AxisStorageOffsets[i_axis][visit.Point[i_axis]];
+	}
+	
+	return storageIndex;
+}
+
+template <std::size_t Dim, class Value>
+std::array<std::vector<std::size_t>, Dim> MultiDimGrid::GridFunction<Dim, Value>::compute_axis_storage_offsets (const StorageLayout layout) const
+{
+	std::array<std::vector<std::size_t>, Dim> axisStorageOffsets;
+	
+	if ( layout == StorageLayout::RowMajor )
+	{
+		return axisStorageOffsets;
+	}
+	
+	std::size_t tileWidth = 2;	// the number of axis points of a tile along each axis is chosen as large as possible, such that a tile still fits into 'StorageTileSize' bytes, but at least 2, which exceeds 'StorageTileSize' bytes in high dimensions
+	
+	while ( std::pow(tileWidth + 1, Dim) * sizeof(Value) <= StorageTileSize )
+	{
+		++tileWidth;
+	}
+	
+	IntegerArray<Dim> axisTileWidths;
+	IntegerArray<Dim> axisTileNumbers;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const std::size_t pointNumber = CoordAxes[i_axis]->point_number();
 		
-		check_coordinate(coord, axis, "interpolate");
+		axisTileWidths[i_axis] = (pointNumber < tileWidth) ? pointNumber : tileWidth;
+		axisTileNumbers[i_axis] = (pointNumber + axisTileWidths[i_axis] - 1) / axisTileWidths[i_axis];
+	}
+	
+	std::size_t innerTileStride = 1;	// index difference between neighbouring grid points within a tile
+	std::size_t tileStride = 1;			// index difference between neighbouring tiles, in units of the tile size
+	
+	std::size_t tileSize = 1;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		tileSize *= axisTileWidths[i_axis];
+	}
+	
+	for ( std::size_t i_axis = Dim; i_axis-- > 0; )	// both the tiles and the grid points within a tile are stored in the nested fashion
+	{
+		const std::size_t axisTileWidth = axisTileWidths[i_axis];
 		
-		GridPoint<Dim> lowerGridPoint = gridPoint;		// in the recursion step with index 'i_axis' the grid point of the parent node (whose axis points on the axes with indices larger or equal to 'i_axis' are already fixed) is used to construct two child nodes...
-		GridPoint<Dim> higherGridPoint = gridPoint;
+		for ( std::size_t i_axisPoint = 0; i_axisPoint < CoordAxes[i_axis]->point_number(); ++i_axisPoint )
+		{
+			axisStorageOffsets[i_axis].push_back( (i_axisPoint / axisTileWidth) * tileStride * tileSize + (i_axisPoint % axisTileWidth) * innerTileStride );
+		}
 		
-		lowerGridPoint[i_nextAxis] = axis->nearest_lower_axis_point_unchecked(coord);	// ...by setting their axis points on the axis with index 'i_axis-1' to the nearest lower and higher axis points of the corresponding coordinate 'coord', respectively
-		higherGridPoint[i_nextAxis] = axis->nearest_higher_axis_point_unchecked(coord);
+		innerTileStride *= axisTileWidth;
+		tileStride *= axisTileNumbers[i_axis];
+	}
+	
+	return axisStorageOffsets;
+}
+
+template <std::size_t Dim, class Value>
+std::size_t MultiDimGrid::GridFunction<Dim, Value>::storage_value_number () const
+{
+	if ( Layout == StorageLayout::RowMajor )
+	{
+		return GridPointNumber;
+	}
+	
+	std::size_t lastStorageIndex = 0;	// incomplete tiles at the upper limits of the axes are only stored up to the last grid point
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		lastStorageIndex += AxisStorageOffsets[i_axis].back();
+	}
+	
+	return lastStorageIndex + 1;
+}
+
+template <std::size_t Dim, class Value>
+template <class CoordinateAccess>
+void MultiDimGrid::GridFunction<Dim, Value>::internal_batch_interpolation (const CoordinateAccess& coordinateAccess, double* values, const std::size_t number, const ParallelSchedule schedule, const bool checkCoordinates, const QueryOrder order) const
+{
+	Counters.add(InterpolationCounter, number);	// counted once for the whole call, so that the batches do not need to update the counters
+	Counters.add(CheckedInterpolationCounter, checkCoordinates ? number : 0);
+	
+	if ( order == QueryOrder::CellSorted )
+	{
+		interpolate_cell_sorted(coordinateAccess, values, number, schedule, checkCoordinates);
+	}
+	else
+	{
+		interpolate_batches(coordinateAccess, values, number, schedule, checkCoordinates);
+	}
+}
+
+template <std::size_t Dim, class Value>
+template <class CoordinateAccess>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_batches (const CoordinateAccess& coordinateAccess, double* values, const std::size_t number, const ParallelSchedule schedule, const bool checkCoordinates) const
+{
+	const std::size_t batchNumber = (number + InterpolationBatchSize - 1) / InterpolationBatchSize;
+	
+	parallel_for(batchNumber, schedule, [&] (const std::size_t i_batch)
+	{
+		const std::size_t i_firstCoords = i_batch * InterpolationBatchSize;
+		const std::size_t batchLength = (number - i_firstCoords < InterpolationBatchSize) ? (number - i_firstCoords) : InterpolationBatchSize;
 		
-		const double lowerValue = internal_recursive_interpolation(coords, lowerGridPoint, i_nextAxis);	// then, the values at these two points are found by performing the same procedure on the next recursion level
-		const double higherValue = internal_recursive_interpolation(coords, higherGridPoint, i_nextAxis);
+		interpolate_batch(coordinateAccess, values, i_firstCoords, batchLength, checkCoordinates);
+	});
+}
+
+template <std::size_t Dim, class Value>
+template <class CoordinateAccess>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_cell_sorted (const CoordinateAccess& coordinateAccess, double* values, const std::size_t number, const ParallelSchedule schedule, const bool checkCoordinates) const
+{
+	const std::size_t storageNumber = storage_value_number();
+	const std::size_t maximumBucketNumber = (number < MaximumSortBucketNumber) ? number : MaximumSortBucketNumber;
+	
+	std::size_t bucketShift = 0;	// the buckets are formed by the storage positions shifted by this number of bits
+	
+	while ( (storageNumber >> bucketShift) > maximumBucketNumber )
+	{
+		++bucketShift;
+	}
+	
+	const std::size_t bucketNumber = (storageNumber >> bucketShift) + 1;
+	
+	std::vector<std::uint32_t> buckets(number);	// bucket of each of the coordinates
+	
+	parallel_for(number, schedule, [&] (const std::size_t i_coords)
+	{
+		std::size_t storagePosition = 0;	// storage position of the lowest corner of the grid cell containing the coordinates
 		
-		const double interpolationWeight = axis->interpolation_weight_unchecked(coord);
+		for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+		{
+			const double coord = coordinateAccess(i_coords, i_axis);
+			
+			if ( checkCoordinates )	// checked here already, since the storage position of a coordinate outside of the grid is undefined
+			{
+				check_coordinate(coord, CoordAxes[i_axis].get(), "GridFunction::interpolate_many");
+			}
+			
+			double interpolationWeight;
+			
+			const std::size_t axisPoint = locate_cell_axis_point(i_axis, coord, interpolationWeight);
+			
+			storagePosition += (Layout == StorageLayout::RowMajor) ? (axisPoint * IndexStrides[i_axis]) : AxisStorageOffsets[i_axis][axisPoint];
+		}
 		
-		return lowerValue * (1.0 - interpolationWeight) + higherValue * interpolationWeight;	// these values and the interpolation weight corresponding to the current axis and coordinate are then used to perform a one dimensional interpolation
+		buckets[i_coords] = storagePosition >> bucketShift;
+	});
+	
+	std::vector<std::size_t> bucketStarts(bucketNumber + 1, 0);	// the coordinates are sorted by a counting sort, which keeps their given order within each bucket
+	
+	for ( std::size_t i_coords = 0; i_coords < number; ++i_coords )
+	{
+		++bucketStarts[buckets[i_coords] + 1];
 	}
-	else
+	
+	for ( std::size_t i_bucket = 0; i_bucket < bucketNumber; ++i_bucket )
+	{
+		bucketStarts[i_bucket + 1] += bucketStarts[i_bucket];
+	}
+	
+	std::vector<std::size_t> givenPositions(number);	// position in the given order of each of the sorted coordinates
+	
+	for ( std::size_t i_coords = 0; i_coords < number; ++i_coords )
 	{
-		return value(gridPoint);	// at the innermost recursion level, when all axis points of a grid point are constructed, the value at this grid point is returned
+		givenPositions[bucketStarts[buckets[i_coords]]++] = i_coords;
 	}
+	
+	std::vector<double> sortedValues(number);
+	
+	interpolate_batches( [&coordinateAccess, &givenPositions] (const std::size_t i_sortedCoords, const std::size_t i_axis) { return coordinateAccess(givenPositions[i_sortedCoords], i_axis); }, sortedValues.data(), number, schedule, false );	// the coordinates are read in the sorted order directly, rather than being copied
+	
+	parallel_for(number, schedule, [&] (const std::size_t i_sortedCoords)
+	{
+		values[givenPositions[i_sortedCoords]] = sortedValues[i_sortedCoords];
+	});
 }
 
-template <std::size_t Dim>
-double MultiDimGrid::GridFunction<Dim>::internal_recursive_interpolation_unchecked (const Coordinates<Dim>& coords, const GridPoint<Dim>& gridPoint, const std::size_t i_axis) const
+template <std::size_t Dim, class Value>
+template <class CoordinateAccess>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_batch (const CoordinateAccess& coordinateAccess, double* values, const std::size_t i_firstCoords, const std::size_t batchLength, const bool checkCoordinates) const
 {
-	if ( i_axis > 0 )	// all the neighbouring grid points of 'coords' are constructed by recursively building up a binary tree with each recursion/branching level corresponding to one of the 'Dim' axes
+	std::array<std::size_t, InterpolationBatchSize> cellIndices;				// index of the lowest corner of the grid cell containing each of the coordinates
+	std::array<double, Dim * InterpolationBatchSize> interpolationWeights;		// interpolation weights of each of the coordinates along each axis, stored axis by axis
+	std::array<double, CornerNumber * InterpolationBatchSize> cornerValues;		// function values at the corners of each grid cell, stored corner by corner
+	std::array<std::size_t, Dim * InterpolationBatchSize> axisStorageSteps;	// in the tiled layout, differences of the storage positions of the higher and lower corners of each grid cell along each axis, stored axis by axis
+	
+	cellIndices.fill(0);
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// the axes are queried axis by axis for all coordinates of the batch
 	{
-		const std::size_t i_nextAxis = i_axis - 1;
-		
-		const double coord = coords[i_nextAxis];
+		const CoordinateAxis* axis = CoordAxes[i_axis].get();
 		
-		const CoordinateAxis* axis = CoordAxes[i_nextAxis];
+		const std::size_t stride = IndexStrides[i_axis];
 		
-		GridPoint<Dim> lowerGridPoint = gridPoint;		// in the recursion step with index 'i_axis' the grid point of the parent node (whose axis points on the axes with indices larger or equal to 'i_axis' are already fixed) is used to construct two child nodes...
-		GridPoint<Dim> higherGridPoint = gridPoint;
+		double* axisWeights = &interpolationWeights[i_axis * InterpolationBatchSize];
 		
-		lowerGridPoint[i_nextAxis] = axis->nearest_lower_axis_point_unchecked(coord);	// ...by setting their axis points on the axis with index 'i_axis-1' to the nearest lower and higher axis points of the corresponding coordinate 'coord', respectively
-		higherGridPoint[i_nextAxis] = axis->nearest_higher_axis_point_unchecked(coord);
+		for ( std::size_t i_batchCoords = 0; i_batchCoords < batchLength; ++i_batchCoords )
+		{
+			const double coord = coordinateAccess(i_firstCoords + i_batchCoords, i_axis);
+			
+			if ( checkCoordinates )
+			{
+				check_coordinate(coord, axis, "GridFunction::interpolate_many");
+			}
+			
+			const std::size_t axisPoint = locate_cell_axis_point(i_axis, coord, axisWeights[i_batchCoords]);
+			
+			if ( Layout == StorageLayout::RowMajor )
+			{
+				cellIndices[i_batchCoords] += axisPoint * stride;
+			}
+			else	// in the tiled layout, the lowest corner is stored at the sum of the axis storage offsets, and the distances to the other corners vary from cell to cell
+			{
+				const std::vector<std::size_t>& axisOffsets = AxisStorageOffsets[i_axis];
+				
+				const std::size_t higherAxisPoint = (axisOffsets.size() > 1) ? (axisPoint + 1) : axisPoint;
+				
+				cellIndices[i_batchCoords] += axisOffsets[axisPoint];
+				axisStorageSteps[i_axis * InterpolationBatchSize + i_batchCoords] = axisOffsets[higherAxisPoint] - axisOffsets[axisPoint];
+			}
+		}
+	}
+	
+	for ( std::size_t i_corner = 0; i_corner < CornerNumber; ++i_corner )	// gather the function values at the corners of all grid cells of the batch
+	{
+		double* batchCornerValues = &cornerValues[i_corner * InterpolationBatchSize];
 		
-		const double lowerValue = internal_recursive_interpolation_unchecked(coords, lowerGridPoint, i_nextAxis);	// then, the values at these two points are found by performing the same procedure on the next recursion level
-		const double higherValue = internal_recursive_interpolation_unchecked(coords, higherGridPoint, i_nextAxis);
+		if ( Layout == StorageLayout::RowMajor )
+		{
+			const std::size_t cornerOffset = CornerOffsets[i_corner];
+			
+			for ( std::size_t i_batchCoords = 0; i_batchCoords < batchLength; ++i_batchCoords )
+			{
+				batchCornerValues[i_batchCoords] = FunctionValues[cellIndices[i_batchCoords] + cornerOffset];
+			}
+		}
+		else
+		{
+			for ( std::size_t i_batchCoords = 0; i_batchCoords < batchLength; ++i_batchCoords )
+			{
+				std::size_t cornerIndex = cellIndices[i_batchCoords];
+				
+				for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// the j-th bit of the corner number states whether the corner lies at the higher axis point of the axis with index (Dim-1-j)
+				{
+					if ( (i_corner >> (Dim - 1 - i_axis)) & 1 )
+					{
+						cornerIndex += axisStorageSteps[i_axis * InterpolationBatchSize + i_batchCoords];
+					}
+				}
+				
+				batchCornerValues[i_batchCoords] = FunctionValues[cornerIndex];
+			}
+		}
+	}
+	
+	std::size_t remainingCornerNumber = CornerNumber;
+	
+	for ( std::size_t i_bit = 0; i_bit < Dim; ++i_bit )	// perform the 1-dimensional interpolations axis by axis, starting with the innermost one, by combining pairs of corners that only differ along that axis; each step halves the number of remaining corners
+	{
+		const double* axisWeights = &interpolationWeights[(Dim - 1 - i_bit) * InterpolationBatchSize];
 		
-		const double interpolationWeight = axis->interpolation_weight_unchecked(coord);
+		remainingCornerNumber /= 2;
 		
-		return lowerValue * (1.0 - interpolationWeight) + higherValue * interpolationWeight;	// these values and the interpolation weight corresponding to the current axis and coordinate are then used to perform a one dimensional interpolation
+		for ( std::size_t i_corner = 0; i_corner < remainingCornerNumber; ++i_corner )
+		{
+			double* combinedValues = &cornerValues[i_corner * InterpolationBatchSize];
+			const double* lowerValues = &cornerValues[(2 * i_corner) * InterpolationBatchSize];
+			const double* higherValues = &cornerValues[(2 * i_corner + 1) * InterpolationBatchSize];
+			
+			for ( std::size_t i_batchCoords = 0; i_batchCoords < batchLength; ++i_batchCoords )	// this innermost loop has no dependencies between iterations and is thus vectorizable
+			{
+				const double interpolationWeight = axisWeights[i_batchCoords];
+				
+				combinedValues[i_batchCoords] = lowerValues[i_batchCoords] * (1.0 - interpolationWeight) + higherValues[i_batchCoords] * interpolationWeight;
+			}
+		}
 	}
-	else
+	
+	for ( std::size_t i_batchCoords = 0; i_batchCoords < batchLength; ++i_batchCoords )
 	{
-		return value(gridPoint);	// at the innermost recursion level, when all axis points of a grid point are constructed, the value at this grid point is returned
+		values[i_firstCoords + i_batchCoords] = cornerValues[i_batchCoords];
 	}
 }
 
-template <std::size_t Dim>
-void MultiDimGrid::GridFunction<Dim>::check_axis_point (const std::size_t axisPoint, const CoordinateAxis* axis, const char* location) const
+template <std::size_t Dim, class Value>
+template <class InputValue>
+std::vector<double> MultiDimGrid::GridFunction<Dim, Value>::contract_axis (const InputValue* const values, std::vector<std::size_t>& shape, const std::size_t i_axis, const std::vector<double>& integrationWeights, const ParallelSchedule schedule)
 {
-	if ( (axisPoint < 0) || (axisPoint >= axis->point_number()) )
+	std::size_t outerNumber = 1;	// number of combinations of axis points on the axes outside of the integration axis
+	std::size_t innerNumber = 1;	// number of combinations of axis points on the axes inside of the integration axis, which is the index stride of the integration axis
+	
+	for ( std::size_t i_otherAxis = 0; i_otherAxis < i_axis; ++i_otherAxis )
 	{
-		std::cout << std::endl
-				  << " MultiDimGrid::GridFunction::" + std::string(location) + " Error: Point not within range of grid" << std::endl
-				  << std::endl;
-		
-		exit(EXIT_FAILURE);
+		outerNumber *= shape[i_otherAxis];
 	}
+	
+	for ( std::size_t i_otherAxis = i_axis + 1; i_otherAxis < shape.size(); ++i_otherAxis )
+	{
+		innerNumber *= shape[i_otherAxis];
+	}
+	
+	const std::size_t axisPointNumber = shape[i_axis];
+	
+	shape.erase(shape.begin() + i_axis);
+	
+	std::vector<double> contractedValues(outerNumber * innerNumber);
+	
+	const std::size_t innerBlockNumber = (innerNumber + ContractionBlockWidth - 1) / ContractionBlockWidth;
+	
+	parallel_for(outerNumber * innerBlockNumber, schedule, [&] (const std::size_t i_block)	// for each combination of outer axis points the function values form 'axisPointNumber' contiguous rows of length 'innerNumber', whose weighted sum is computed in blocks of adjacent columns
+	{
+		const std::size_t i_outer = i_block / innerBlockNumber;
+		const std::size_t i_firstInner = (i_block - i_outer * innerBlockNumber) * ContractionBlockWidth;
+		const std::size_t width = (innerNumber - i_firstInner < ContractionBlockWidth) ? (innerNumber - i_firstInner) : ContractionBlockWidth;
+		
+		const InputValue* rows = &values[i_outer * axisPointNumber * innerNumber + i_firstInner];
+		
+		pairwise_weighted_sum(rows, integrationWeights.data(), axisPointNumber, innerNumber, width, &contractedValues[i_outer * innerNumber + i_firstInner]);
+	});
+	
+	return contractedValues;
 }
 
-template <std::size_t Dim>
-void MultiDimGrid::GridFunction<Dim>::check_coordinate (const double coord, const CoordinateAxis* axis, const char* location) const
+template <std::size_t Dim, class Value>
+template <class InputValue, class OutputValue>
+void MultiDimGrid::GridFunction<Dim, Value>::interpolate_axis (const InputValue* const values, OutputValue* const interpolatedValues, std::vector<std::size_t>& shape, const std::size_t i_axis, const std::vector<AxisLocation>& axisLocations, const ParallelSchedule schedule)
 {
-	if ( (coord < axis->lower_coordinate_limit()) || (coord > axis->upper_coordinate_limit()) )
+	std::size_t outerNumber = 1;	// number of combinations of axis points on the axes outside of the interpolation axis
+	std::size_t innerNumber = 1;	// number of combinations of axis points on the axes inside of the interpolation axis, which is the index stride of the interpolation axis
+	
+	for ( std::size_t i_otherAxis = 0; i_otherAxis < i_axis; ++i_otherAxis )
 	{
-		std::cout << std::endl
-				  << " MultiDimGrid::GridFunction::" + std::string(location) + " Coordinates not within range of grid" << std::endl
-				  << std::endl;
-		
-		exit(EXIT_FAILURE);
+		outerNumber *= shape[i_otherAxis];
+	}
+	
+	for ( std::size_t i_otherAxis = i_axis + 1; i_otherAxis < shape.size(); ++i_otherAxis )
+	{
+		innerNumber *= shape[i_otherAxis];
 	}
+	
+	const std::size_t axisPointNumber = shape[i_axis];
+	const std::size_t newAxisPointNumber = axisLocations.size();
+	
+	shape[i_axis] = newAxisPointNumber;
+	
+	parallel_for(outerNumber * newAxisPointNumber, schedule, [&] (const std::size_t i_newRow)	// for each combination of outer axis points the function values form 'axisPointNumber' contiguous rows of length 'innerNumber', and each new row is the weighted sum of the two rows at the neighbouring old axis points
+	{
+		const std::size_t i_outer = i_newRow / newAxisPointNumber;
+		
+		const AxisLocation& location = axisLocations[i_newRow - i_outer * newAxisPointNumber];
+		const double interpolationWeight = location.InterpolationWeight;
+		
+		const InputValue* lowerRow = &values[(i_outer * axisPointNumber + location.LowerAxisPoint) * innerNumber];
+		const InputValue* higherRow = &values[(i_outer * axisPointNumber + location.HigherAxisPoint) * innerNumber];
+		OutputValue* interpolatedRow = &interpolatedValues[i_newRow * innerNumber];
+		
+		for ( std::size_t i_column = 0; i_column < innerNumber; ++i_column )
+		{
+			interpolatedRow[i_column] = static_cast<double>(lowerRow[i_column]) * (1.0 - interpolationWeight) + static_cast<double>(higherRow[i_column]) * interpolationWeight;
+		}
+	});
 }
 
-template <std::size_t Dim>
-void MultiDimGrid::GridFunction<Dim>::check_index (const std::size_t index, const char* location) const
+template <std::size_t Dim, class Value>
+template <class InputValue>
+void MultiDimGrid::GridFunction<Dim, Value>::pairwise_weighted_sum (const InputValue* values, const double* weights, const std::size_t number, const std::size_t stride, const std::size_t width, double* sums)
 {
-	if ( index >= GridPointNumber )
+	if ( number <= PairwiseSummationBaseLength )	// few rows are summed up directly...
 	{
-		std::cout << std::endl
-				  << " MultiDimGrid::GridFunction::" + std::string(location) + " Index not within range of grid" << std::endl
-				  << std::endl;
+		for ( std::size_t i_column = 0; i_column < width; ++i_column )
+		{
+			sums[i_column] = 0.0;
+		}
 		
-		exit(EXIT_FAILURE);
+		for ( std::size_t i_row = 0; i_row < number; ++i_row )
+		{
+			const double weight = weights[i_row];
+			const InputValue* row = &values[i_row * stride];
+			
+			for ( std::size_t i_column = 0; i_column < width; ++i_column )
+			{
+				sums[i_column] += weight * static_cast<double>(row[i_column]);
+			}
+		}
+	}
+	else	// ...while more rows are split into two halves that are summed up separately, such that the rounding error grows only logarithmically with the number of rows (unlike compensated summation, this is not undone by '-ffast-math')
+	{
+		const std::size_t lowerNumber = number / 2;
+		
+		std::array<double, ContractionBlockWidth> higherSums;
+		
+		pairwise_weighted_sum(values, weights, lowerNumber, stride, width, sums);
+		pairwise_weighted_sum(&values[lowerNumber * stride], &weights[lowerNumber], number - lowerNumber, stride, width, higherSums.data());
+		
+		for ( std::size_t i_column = 0; i_column < width; ++i_column )
+		{
+			sums[i_column] += higherSums[i_column];
+		}
 	}
 }
\ No newline at end of file
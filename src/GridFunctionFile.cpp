@@ -0,0 +1,424 @@
+#include "GridFunctionFile.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace MultiDimGrid
+{
+	/**
+	 * Header at the beginning of a grid function file. All members have fixed sizes and are naturally aligned, such that
+	 * the layout does not depend on the compiler.
+	 */
+	struct GridFunctionFileHeader
+	{
+		/**
+		 * Identifier of the file format, which is always "MDGRIDFN".
+		 */
+		char Magic[8];
+		
+		/**
+		 * Version of the file format.
+		 */
+		std::uint32_t Version;
+		
+		/**
+		 * Number of coordinate axes.
+		 */
+		std::uint32_t Dimension;
+		
+		/**
+		 * The number 0x01020304 in the byte order of the machine that has written the file.
+		 */
+		std::uint32_t ByteOrderMark;
+		
+		/**
+		 * Size of a single function value in bytes.
+		 */
+		std::uint32_t ValueSize;
+		
+		/**
+		 * Type of the function values, as a FunctionValueType.
+		 */
+		std::uint32_t ValueType;
+		
+		/**
+		 * Padding, which is always zero.
+		 */
+		std::uint32_t Reserved;
+		
+		/**
+		 * Number of function values.
+		 */
+		std::uint64_t ValueNumber;
+		
+		/**
+		 * Offset of the first function value from the beginning of the file in bytes.
+		 */
+		std::uint64_t ValueOffset;
+	};
+	
+	/**
+	 * Description of a single coordinate axis, as stored in a grid function file directly after the GridFunctionFileHeader.
+	 */
+	struct GridFunctionFileAxisRecord
+	{
+		std::uint32_t Type;
+		std::uint32_t Reserved;
+		double LowerCoordinateLimit;
+		double UpperCoordinateLimit;
+		double SpacingThresholdValue;
+		std::uint64_t IntervalNumber;
+		std::uint64_t LinearIntervalNumber;
+	};
+	
+	/**
+	 * Control block at the beginning of a grid function segment, followed by the image of a grid function file at the
+	 * offset MultiDimGrid::GridFunctionFileAlignment.
+	 */
+	struct GridFunctionSegmentControl
+	{
+		/**
+		 * Number of attachments to the segment by all processes. It is zero until the segment is completely written,
+		 * and the segment is removed when it drops back to zero.
+		 */
+		std::atomic<std::uint64_t> AttachmentNumber;
+	};
+	
+	static_assert(sizeof(GridFunctionFileHeader) == 48, "MultiDimGrid::GridFunctionFileHeader Error: Unexpected padding");
+	static_assert(sizeof(GridFunctionFileAxisRecord) == 48, "MultiDimGrid::GridFunctionFileAxisRecord Error: Unexpected padding");
+	static_assert((std::is_same<std::uint64_t, unsigned long>::value ? ATOMIC_LONG_LOCK_FREE : ATOMIC_LLONG_LOCK_FREE) == 2, "MultiDimGrid::GridFunctionSegmentControl Error: Attachment number can not be shared between processes");	// std::uint64_t is 'unsigned long' on LP64 systems and 'unsigned long long' elsewhere
+	
+	/**
+	 * Identifier of the grid function file format.
+	 */
+	constexpr char GridFunctionFileMagic[8] = {'M', 'D', 'G', 'R', 'I', 'D', 'F', 'N'};
+	
+	/**
+	 * Mark used to recognize files written with a different byte order.
+	 */
+	constexpr std::uint32_t GridFunctionFileByteOrderMark = 0x01020304;
+	
+	namespace	// helpers only used within this file
+	{
+		/**
+		 * Writes an error message containing \a message and the file name \a fileName to the standard output and terminates
+		 * the program.
+		 */
+		void grid_function_file_error (const std::string& message, const std::string& fileName)
+		{
+			std::cout << std::endl
+					  << " MultiDimGrid Error: " << message << " '" << fileName << "'" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+		}
+		
+		/**
+		 * Returns the header, the axis records and the zero padding up to the first function value of a grid function file
+		 * containing the descriptions \a axisDescriptions of the coordinate axes and \a number function values, each of
+		 * which is of type \a valueType and has a size of \a valueSize bytes. \a fileName is only used in error messages.
+		 */
+		std::vector<char> grid_function_file_leading_bytes (const std::vector<AxisDescription>& axisDescriptions, const FunctionValueType valueType, const std::size_t valueSize, const std::size_t number, const std::string& fileName)
+		{
+			for ( const AxisDescription& description : axisDescriptions )
+			{
+				if ( description.Type == AxisType::Custom )	// a custom axis could not be reconstructed when the file is read
+				{
+					grid_function_file_error("Custom coordinate axes can not be stored in grid function file", fileName);
+				}
+			}
+			
+			const std::size_t descriptionEnd = sizeof(GridFunctionFileHeader) + axisDescriptions.size() * sizeof(GridFunctionFileAxisRecord);
+			const std::size_t valueOffset = (descriptionEnd + GridFunctionFileAlignment - 1) / GridFunctionFileAlignment * GridFunctionFileAlignment;	// round up to the next multiple of the alignment
+			
+			std::vector<char> leadingBytes(valueOffset, 0);
+			
+			GridFunctionFileHeader header;
+			
+			std::memcpy(header.Magic, GridFunctionFileMagic, sizeof(header.Magic));
+			header.Version = GridFunctionFileVersion;
+			header.Dimension = axisDescriptions.size();
+			header.ByteOrderMark = GridFunctionFileByteOrderMark;
+			header.ValueSize = valueSize;
+			header.ValueType = static_cast<std::uint32_t>(valueType);
+			header.Reserved = 0;
+			header.ValueNumber = number;
+			header.ValueOffset = valueOffset;
+			
+			std::memcpy(leadingBytes.data(), &header, sizeof(header));
+			
+			for ( std::size_t i_axis = 0; i_axis < axisDescriptions.size(); ++i_axis )
+			{
+				const AxisDescription& description = axisDescriptions[i_axis];
+				
+				GridFunctionFileAxisRecord record;
+				
+				record.Type = static_cast<std::uint32_t>(description.Type);
+				record.Reserved = 0;
+				record.LowerCoordinateLimit = description.LowerCoordinateLimit;
+				record.UpperCoordinateLimit = description.UpperCoordinateLimit;
+				record.SpacingThresholdValue = description.SpacingThresholdValue;
+				record.IntervalNumber = description.IntervalNumber;
+				record.LinearIntervalNumber = description.LinearIntervalNumber;
+				
+				std::memcpy(&leadingBytes[sizeof(header) + i_axis * sizeof(record)], &record, sizeof(record));
+			}
+			
+			return leadingBytes;
+		}
+		
+		/**
+		 * Returns the content of the image of a grid function file of \a size bytes starting at \a bytes, whose function
+		 * values refer to the image directly. \a fileName is only used in error messages. The owner of the mapping is left
+		 * empty.
+		 */
+		GridFunctionFileContent read_grid_function_file_content (char* const bytes, const std::size_t size, const std::string& fileName)
+		{
+			if ( size < sizeof(GridFunctionFileHeader) )
+			{
+				grid_function_file_error("Invalid grid function file", fileName);
+			}
+			
+			GridFunctionFileHeader header;
+			
+			std::memcpy(&header, bytes, sizeof(header));
+			
+			if ( std::memcmp(header.Magic, GridFunctionFileMagic, sizeof(header.Magic)) != 0 )
+			{
+				grid_function_file_error("Not a grid function file", fileName);
+			}
+			
+			if ( header.ByteOrderMark != GridFunctionFileByteOrderMark )
+			{
+				grid_function_file_error("Byte order does not match the one of this machine in grid function file", fileName);
+			}
+			
+			if ( header.Version != GridFunctionFileVersion )
+			{
+				grid_function_file_error("Unsupported version of grid function file", fileName);
+			}
+			
+			if ( header.ValueSize == 0 )
+			{
+				grid_function_file_error("Invalid function value size in grid function file", fileName);
+			}
+			
+			if ( header.Dimension > (size - sizeof(GridFunctionFileHeader)) / sizeof(GridFunctionFileAxisRecord) )	// checked before the size of the axis records is computed, which could otherwise overflow
+			{
+				grid_function_file_error("Truncated or corrupted grid function file", fileName);
+			}
+			
+			const std::size_t descriptionEnd = sizeof(GridFunctionFileHeader) + header.Dimension * sizeof(GridFunctionFileAxisRecord);
+			
+			if ( (header.ValueOffset > size) || (header.ValueOffset < descriptionEnd) || (header.ValueOffset % header.ValueSize != 0) || (header.ValueNumber > (size - header.ValueOffset) / header.ValueSize) )
+			{
+				grid_function_file_error("Truncated or corrupted grid function file", fileName);
+			}
+			
+			GridFunctionFileContent content;
+			
+			for ( std::size_t i_axis = 0; i_axis < header.Dimension; ++i_axis )
+			{
+				GridFunctionFileAxisRecord record;
+				
+				std::memcpy(&record, &bytes[sizeof(header) + i_axis * sizeof(record)], sizeof(record));
+				
+				content.AxisDescriptions.push_back( {static_cast<AxisType>(record.Type), record.LowerCoordinateLimit, record.UpperCoordinateLimit, record.SpacingThresholdValue, static_cast<std::size_t>(record.IntervalNumber), static_cast<std::size_t>(record.LinearIntervalNumber)} );
+			}
+			
+			content.ValueType = static_cast<FunctionValueType>(header.ValueType);
+			content.ValueSize = header.ValueSize;
+			content.ValueNumber = header.ValueNumber;
+			content.Values = bytes + header.ValueOffset;
+			content.IsReadOnly = false;
+			
+			return content;
+		}
+		
+		/**
+		 * Returns the content of the grid function segment with name \a segmentName and size \a segmentSize, which is mapped
+		 * to \a address and has already been attached to by incrementing its attachment number. The function values are
+		 * protected against writing. The owner of the mapping detaches from the segment when it is destroyed and removes
+		 * the segment if it was the last attachment.
+		 */
+		GridFunctionFileContent grid_function_segment_content (void* const address, const std::size_t segmentSize, const std::string& segmentName)
+		{
+			std::shared_ptr<void> mapping(address, [segmentSize, segmentName] (void* const mappedAddress)
+			{
+				const bool isLastAttachment = (static_cast<GridFunctionSegmentControl*>(mappedAddress)->AttachmentNumber.fetch_sub(1, std::memory_order_acq_rel) == 1);
+				
+				munmap(mappedAddress, segmentSize);
+				
+				if ( isLastAttachment )
+				{
+					shm_unlink(segmentName.c_str());
+				}
+			});
+			
+			char* const image = static_cast<char*>(address) + GridFunctionFileAlignment;
+			
+			GridFunctionFileContent content = read_grid_function_file_content(image, segmentSize - GridFunctionFileAlignment, segmentName);
+			
+			content.Mapping = mapping;
+			
+			if ( mprotect(content.Values, segmentSize - (static_cast<char*>(content.Values) - static_cast<char*>(address)), PROT_READ) != 0 )	// the function values start at a page boundary, while the control block in the first page stays writable
+			{
+				grid_function_file_error("Could not protect function values in shared memory segment", segmentName);
+			}
+			
+			content.IsReadOnly = true;
+			
+			return content;
+		}
+	}
+}
+
+void MultiDimGrid::write_grid_function_file (const std::string& fileName, const std::vector<AxisDescription>& axisDescriptions, const void* const values, const FunctionValueType valueType, const std::size_t valueSize, const std::size_t number)
+{
+	const std::vector<char> leadingBytes = grid_function_file_leading_bytes(axisDescriptions, valueType, valueSize, number, fileName);	// header, axis records and zero padding up to the first function value
+	
+	std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+	
+	file.write(leadingBytes.data(), leadingBytes.size());
+	file.write(static_cast<const char*>(values), number * valueSize);
+	file.close();
+	
+	if ( !file )
+	{
+		grid_function_file_error("Could not write grid function file", fileName);
+	}
+}
+
+MultiDimGrid::GridFunctionFileContent MultiDimGrid::map_grid_function_file (const std::string& fileName)
+{
+	const int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+	
+	if ( fileDescriptor < 0 )
+	{
+		grid_function_file_error("Could not open grid function file", fileName);
+	}
+	
+	struct stat fileStatus;
+	
+	if ( (fstat(fileDescriptor, &fileStatus) != 0) || (static_cast<std::size_t>(fileStatus.st_size) < sizeof(GridFunctionFileHeader)) )
+	{
+		grid_function_file_error("Invalid grid function file", fileName);
+	}
+	
+	const std::size_t fileSize = fileStatus.st_size;
+	
+	void* const address = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);	// a private writable mapping allows to modify the values in memory without ever modifying the file
+	
+	close(fileDescriptor);	// the mapping stays valid after closing the file
+	
+	if ( address == MAP_FAILED )
+	{
+		grid_function_file_error("Could not map grid function file", fileName);
+	}
+	
+	std::shared_ptr<void> mapping(address, [fileSize] (void* const mappedAddress) { munmap(mappedAddress, fileSize); });
+	
+	GridFunctionFileContent content = read_grid_function_file_content(static_cast<char*>(address), fileSize, fileName);
+	
+	content.Mapping = mapping;
+	
+	return content;
+}
+
+MultiDimGrid::GridFunctionFileContent MultiDimGrid::publish_grid_function_segment (const std::string& segmentName, const std::vector<AxisDescription>& axisDescriptions, const void* const values, const FunctionValueType valueType, const std::size_t valueSize, const std::size_t number)
+{
+	const std::vector<char> leadingBytes = grid_function_file_leading_bytes(axisDescriptions, valueType, valueSize, number, segmentName);
+	
+	const std::size_t segmentSize = GridFunctionFileAlignment + leadingBytes.size() + number * valueSize;	// the control block occupies the first page, followed by the image of a grid function file
+	
+	const int segmentDescriptor = shm_open(segmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);	// creating the segment exclusively ensures that a published segment is never overwritten
+	
+	if ( segmentDescriptor < 0 )
+	{
+		grid_function_file_error("Could not create shared memory segment", segmentName);
+	}
+	
+	void* const address = (ftruncate(segmentDescriptor, segmentSize) == 0) ? mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, segmentDescriptor, 0) : MAP_FAILED;
+	
+	close(segmentDescriptor);	// the mapping stays valid after closing the segment
+	
+	if ( address == MAP_FAILED )
+	{
+		shm_unlink(segmentName.c_str());
+		
+		grid_function_file_error("Could not map shared memory segment", segmentName);
+	}
+	
+	char* const bytes = static_cast<char*>(address);
+	
+	std::memcpy(&bytes[GridFunctionFileAlignment], leadingBytes.data(), leadingBytes.size());
+	std::memcpy(&bytes[GridFunctionFileAlignment + leadingBytes.size()], values, number * valueSize);
+	
+	GridFunctionSegmentControl* const control = new (address) GridFunctionSegmentControl;
+	
+	control->AttachmentNumber.store(1, std::memory_order_release);	// the publishing process holds the first attachment; only now the segment can be attached to by other processes, which see its complete content
+	
+	return grid_function_segment_content(address, segmentSize, segmentName);
+}
+
+MultiDimGrid::GridFunctionFileContent MultiDimGrid::attach_grid_function_segment (const std::string& segmentName)
+{
+	const int segmentDescriptor = shm_open(segmentName.c_str(), O_RDWR, 0);
+	
+	if ( segmentDescriptor < 0 )
+	{
+		grid_function_file_error("Could not open shared memory segment", segmentName);
+	}
+	
+	struct stat segmentStatus;
+	
+	if ( (fstat(segmentDescriptor, &segmentStatus) != 0) || (static_cast<std::size_t>(segmentStatus.st_size) < GridFunctionFileAlignment) )
+	{
+		grid_function_file_error("Shared memory segment is not published", segmentName);
+	}
+	
+	const std::size_t segmentSize = segmentStatus.st_size;
+	
+	void* const address = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, segmentDescriptor, 0);	// the control block has to be writable, the function values are protected afterwards
+	
+	close(segmentDescriptor);
+	
+	if ( address == MAP_FAILED )
+	{
+		grid_function_file_error("Could not map shared memory segment", segmentName);
+	}
+	
+	std::atomic<std::uint64_t>& attachmentNumber = static_cast<GridFunctionSegmentControl*>(address)->AttachmentNumber;
+	
+	std::uint64_t currentAttachmentNumber = attachmentNumber.load(std::memory_order_acquire);
+	
+	do	// an attachment is only possible as long as the segment is published, i.e. after it has been completely written and before its last attachment has been released
+	{
+		if ( currentAttachmentNumber == 0 )
+		{
+			munmap(address, segmentSize);
+			
+			grid_function_file_error("Shared memory segment is not published", segmentName);
+		}
+	}
+	while ( !attachmentNumber.compare_exchange_weak(currentAttachmentNumber, currentAttachmentNumber + 1, std::memory_order_acq_rel, std::memory_order_acquire) );
+	
+	return grid_function_segment_content(address, segmentSize, segmentName);
+}
+
+void MultiDimGrid::remove_grid_function_segment (const std::string& segmentName)
+{
+	shm_unlink(segmentName.c_str());
+}
\ No newline at end of file
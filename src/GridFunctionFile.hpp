@@ -0,0 +1,160 @@
+#ifndef MULTIDIMGRID_GRID_FUNCTION_FILE_H
+#define MULTIDIMGRID_GRID_FUNCTION_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CoordinateAxis.hpp"
+#include "HalfFloat.hpp"
+
+namespace MultiDimGrid
+{
+	/**
+	 * Types of the function values stored in a grid function file.
+	 * 
+	 * The numerical values are part of the binary file format of GridFunction and must therefore never be changed.
+	 */
+	enum class FunctionValueType : std::uint32_t
+	{
+		Double = 1,
+		Float = 2,
+		HalfFloat = 3
+	};
+	
+	/**
+	 * Provides the FunctionValueType of the value type \a Value as its member \c Type. It is only defined for the value
+	 * types supported by GridFunction.
+	 */
+	template <class Value>
+	struct FunctionValueTypeOf;
+	
+	template <>
+	struct FunctionValueTypeOf<double>
+	{
+		static constexpr FunctionValueType Type = FunctionValueType::Double;
+	};
+	
+	template <>
+	struct FunctionValueTypeOf<float>
+	{
+		static constexpr FunctionValueType Type = FunctionValueType::Float;
+	};
+	
+	template <>
+	struct FunctionValueTypeOf<HalfFloat>
+	{
+		static constexpr FunctionValueType Type = FunctionValueType::HalfFloat;
+	};
+	
+	/**
+	 * Content of a grid function file, consisting of the descriptions of the coordinate axes spanning up the grid and the
+	 * function values.
+	 */
+	struct GridFunctionFileContent
+	{
+		/**
+		 * Descriptions of the coordinate axes.
+		 */
+		std::vector<AxisDescription> AxisDescriptions;
+		
+		/**
+		 * Type of the function values.
+		 */
+		FunctionValueType ValueType;
+		
+		/**
+		 * Size of a single function value in bytes.
+		 */
+		std::size_t ValueSize;
+		
+		/**
+		 * Number of function values.
+		 */
+		std::size_t ValueNumber;
+		
+		/**
+		 * Pointer to the first function value within the mapped file.
+		 */
+		void* Values;
+		
+		/**
+		 * Whether the function values are protected against writing.
+		 */
+		bool IsReadOnly;
+		
+		/**
+		 * Owner of the mapped file, which is unmapped as soon as neither this nor any of its copies is left.
+		 */
+		std::shared_ptr<void> Mapping;
+	};
+	
+	/**
+	 * Writes a grid function file with name \a fileName containing the descriptions \a axisDescriptions of the coordinate
+	 * axes and the \a number function values starting at \a values, each of which is of type \a valueType and has a
+	 * size of \a valueSize bytes.
+	 * 
+	 * The file consists of a header that identifies the format and its version as well as the type and size of the function
+	 * values, the axis descriptions, and the raw function values. The function values start at an offset that is a multiple
+	 * of MultiDimGrid::GridFunctionFileAlignment, such that they can be used in place when the file is mapped into memory
+	 * by MultiDimGrid::map_grid_function_file. All numbers are stored in the native byte order, which is recorded in the
+	 * header.
+	 */
+	void write_grid_function_file (const std::string& fileName, const std::vector<AxisDescription>& axisDescriptions, const void* values, FunctionValueType valueType, std::size_t valueSize, std::size_t number);
+	
+	/**
+	 * Maps the grid function file with name \a fileName, written by MultiDimGrid::write_grid_function_file, into memory
+	 * and returns its content. The function values are not copied but refer to the mapped file directly, which is unmapped
+	 * when the last owner referring to it is destroyed.
+	 * 
+	 * The mapping is private, i.e. modifications of the function values only affect private copies of the modified
+	 * memory pages and are never written back to the file.
+	 */
+	GridFunctionFileContent map_grid_function_file (const std::string& fileName);
+	
+	/**
+	 * Publishes the descriptions \a axisDescriptions of the coordinate axes and the \a number function values starting
+	 * at \a values, each of which is of type \a valueType and has a size of \a valueSize bytes, in a new POSIX shared memory segment with name
+	 * \a segmentName, which has to start with a slash and must not exist yet. Returns the content of the segment, to
+	 * which the calling process is attached as described for MultiDimGrid::attach_grid_function_segment.
+	 * 
+	 * The segment consists of a page holding the number of attachments, followed by the image of the grid function file
+	 * that MultiDimGrid::write_grid_function_file would write.
+	 */
+	GridFunctionFileContent publish_grid_function_segment (const std::string& segmentName, const std::vector<AxisDescription>& axisDescriptions, const void* values, FunctionValueType valueType, std::size_t valueSize, std::size_t number);
+	
+	/**
+	 * Attaches to the POSIX shared memory segment with name \a segmentName, published by MultiDimGrid::publish_grid_function_segment
+	 * in any process, and returns its content. The function values are not copied but refer to the segment directly,
+	 * so all processes attached to it share the same physical memory. They are mapped read-only, i.e. modifying them
+	 * terminates the program with a segmentation fault, which is recorded in GridFunctionFileContent::IsReadOnly.
+	 * 
+	 * Every attachment is counted in the segment. It is released when the last owner referring to the mapping is destroyed,
+	 * and the segment is removed when its last attachment in any process is released. Attachments of processes that
+	 * terminate without releasing them are never released, in which case the segment has to be removed with
+	 * MultiDimGrid::remove_grid_function_segment.
+	 */
+	GridFunctionFileContent attach_grid_function_segment (const std::string& segmentName);
+	
+	/**
+	 * Removes the name \a segmentName of a POSIX shared memory segment published by MultiDimGrid::publish_grid_function_segment,
+	 * regardless of its attachments. Existing attachments stay valid, while new ones are no longer possible. The name
+	 * must not be published again before all attachments to the removed segment have been released.
+	 */
+	void remove_grid_function_segment (const std::string& segmentName);
+	
+	/**
+	 * Alignment in bytes of the function values within a grid function file. It is the common memory page size, such
+	 * that the values start at a page boundary when the file is mapped into memory.
+	 */
+	constexpr std::size_t GridFunctionFileAlignment = 4096;
+	
+	/**
+	 * Version of the grid function file format written by MultiDimGrid::write_grid_function_file.
+	 */
+	constexpr std::uint32_t GridFunctionFileVersion = 2;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "HalfFloat.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+MultiDimGrid::HalfFloat::HalfFloat () :
+	Bits(0)
+{}
+
+MultiDimGrid::HalfFloat::HalfFloat (const double value)
+{
+	const float singleValue = static_cast<float>(value);	// converting via single precision rounds twice, which differs from a direct conversion only for values extremely close to the midpoint between two half-precision numbers
+	
+	std::uint32_t singleBits;
+	
+	std::memcpy(&singleBits, &singleValue, sizeof(singleBits));
+	
+	const std::uint32_t sign = (singleBits >> 16) & 0x8000;
+	const std::uint32_t magnitude = singleBits & 0x7fffffff;
+	
+	if ( magnitude >= 0x7f800000 )	// infinity or NaN, keeping NaNs quiet
+	{
+		Bits = sign | 0x7c00 | ( (magnitude > 0x7f800000) ? 0x0200 : 0 );
+	}
+	else if ( magnitude >= 0x477ff000 )	// magnitudes of at least 65520 round to infinity
+	{
+		Bits = sign | 0x7c00;
+	}
+	else if ( magnitude >= 0x38800000 )	// magnitudes of at least 2^-14 are normal half-precision numbers, whose exponent bias differs by 112 from the single-precision one and which have 13 mantissa bits less
+	{
+		std::uint32_t halfMagnitude = (magnitude >> 13) - (112 << 10);
+		
+		const std::uint32_t remainder = magnitude & 0x1fff;
+		
+		if ( (remainder > 0x1000) || ((remainder == 0x1000) && (halfMagnitude & 1)) )	// round to nearest, ties to even; a carry into the exponent is correct
+		{
+			++halfMagnitude;
+		}
+		
+		Bits = sign | halfMagnitude;
+	}
+	else	// smaller magnitudes become subnormal half-precision numbers, i.e. multiples of 2^-24, or zero
+	{
+		const std::uint32_t exponent = magnitude >> 23;
+		const std::uint32_t shift = 126 - exponent;	// a single-precision number equals its mantissa including the implicit leading bit times 2^(exponent - 150)
+		
+		if ( shift > 24 )	// magnitudes below 2^-25 round to zero
+		{
+			Bits = sign;
+		}
+		else
+		{
+			const std::uint32_t mantissa = (magnitude & 0x007fffff) | 0x00800000;
+			
+			std::uint32_t halfMagnitude = mantissa >> shift;
+			
+			const std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+			const std::uint32_t halfway = 1u << (shift - 1);
+			
+			if ( (remainder > halfway) || ((remainder == halfway) && (halfMagnitude & 1)) )	// round to nearest, ties to even; a carry into the smallest normal number is correct
+			{
+				++halfMagnitude;
+			}
+			
+			Bits = sign | halfMagnitude;
+		}
+	}
+}
+
+MultiDimGrid::HalfFloat::operator double () const
+{
+	const std::uint32_t sign = static_cast<std::uint32_t>(Bits & 0x8000) << 16;
+	const std::uint32_t exponent = (Bits >> 10) & 0x1f;
+	const std::uint32_t mantissa = Bits & 0x03ff;
+	
+	std::uint32_t singleBits;
+	
+	if ( exponent == 0x1f )	// infinity or NaN
+	{
+		singleBits = sign | 0x7f800000 | (mantissa << 13);
+	}
+	else if ( exponent != 0 )	// normal number
+	{
+		singleBits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+	else	// zero or subnormal number, which equals its mantissa times 2^-24 and is normal in single precision
+	{
+		const float magnitude = static_cast<float>(mantissa) * 5.9604644775390625e-8f;	// 2^-24
+		
+		std::memcpy(&singleBits, &magnitude, sizeof(singleBits));
+		
+		singleBits |= sign;
+	}
+	
+	float singleValue;
+	
+	std::memcpy(&singleValue, &singleBits, sizeof(singleValue));
+	
+	return singleValue;
+}
+
+std::uint16_t MultiDimGrid::HalfFloat::bits () const
+{
+	return Bits;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef MULTIDIMGRID_HALF_FLOAT_H
+#define MULTIDIMGRID_HALF_FLOAT_H
+
+#include <cstdint>
+
+namespace MultiDimGrid
+{
+	/**
+	 * \brief Class implementing a storage-only IEEE 754 half-precision (binary16) floating-point number.
+	 * 
+	 * It can be used as the value type of a GridFunction to quarter the memory footprint and memory bandwidth compared
+	 * to \c double, at the cost of a relative precision of about 5e-4 and a range limited to magnitudes below 65504.
+	 * No arithmetic is provided: values are converted from \c double, rounded to the nearest representable number,
+	 * when they are stored, and widened to \c double again when they are read.
+	 */
+	class HalfFloat
+	{
+	public:
+		/**
+		 * Constructor instantiating a half-precision number with value 0.
+		 */
+		HalfFloat ();
+		
+		/**
+		 * Constructor instantiating a half-precision number with the value nearest to \a value. Values whose magnitude
+		 * exceeds the range of half precision are converted to infinity.
+		 */
+		HalfFloat (double value);
+		
+		/**
+		 * Returns the value of the half-precision number as a \c double. This conversion is exact.
+		 */
+		operator double () const;
+		
+		/**
+		 * Returns the binary16 bit pattern of the half-precision number.
+		 */
+		std::uint16_t bits () const;
+	
+	private:
+		/**
+		 * The binary16 bit pattern, consisting of 1 sign bit, 5 exponent bits and 10 mantissa bits.
+		 */
+		std::uint16_t Bits;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "Instrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+std::size_t MultiDimGrid::instrumentation_thread_slot ()
+{
+	static std::atomic<std::size_t> nextThreadSlot(0);	// threads are assigned the slots in the order in which they first update a counter, and all threads beyond the last slot share it
+	
+	thread_local const std::size_t threadSlot = std::min(nextThreadSlot.fetch_add(1, std::memory_order_relaxed), InstrumentationSlotNumber - 1);
+	
+	return threadSlot;
+}
+
+std::uint64_t MultiDimGrid::instrumentation_time ()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
\ No newline at end of file
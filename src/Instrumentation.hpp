@@ -0,0 +1,194 @@
+#ifndef MULTIDIMGRID_INSTRUMENTATION_H
+#define MULTIDIMGRID_INSTRUMENTATION_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MultiDimGrid
+{
+	/**
+	 * States whether the instrumentation of GridFunction and CoordinateAxis is enabled.
+	 * 
+	 * The instrumentation is enabled by defining the macro \c MULTIDIMGRID_INSTRUMENTATION, e.g. by building with
+	 * \c make \c INSTRUMENTATION=1. As it changes the layout of the instrumented classes, the macro has to be defined
+	 * consistently for the library and all code using it. If it is not defined, the counters are empty and all counts
+	 * reported by the instrumented classes are zero.
+	 */
+	#ifdef MULTIDIMGRID_INSTRUMENTATION
+	constexpr bool InstrumentationEnabled = true;
+	#else
+	constexpr bool InstrumentationEnabled = false;
+	#endif
+	
+	/**
+	 * Number of slots into which the counts of every instrumented object are split. Each of the first threads that
+	 * update counters owns one of these slots, so that threads do not compete for the same counts. All further threads
+	 * share the last slot.
+	 */
+	constexpr std::size_t InstrumentationSlotNumber = 64;
+	
+	/**
+	 * Snapshot of the instrumentation counters of a GridFunction.
+	 */
+	struct GridFunctionCounters
+	{
+		/**
+		 * Number of coordinates interpolated by the scalar as well as the batched methods, with or without gradient.
+		 */
+		std::uint64_t Interpolations;
+		
+		/**
+		 * Number of these coordinates that were checked to be within the range of the grid beforehand.
+		 */
+		std::uint64_t CheckedInterpolations;
+		
+		/**
+		 * Number of evaluations of the function passed to the constructor or to GridFunction::refine.
+		 */
+		std::uint64_t FunctionEvaluations;
+		
+		/**
+		 * Total time in seconds spent within these function evaluations, summed over all threads.
+		 */
+		double FunctionEvaluationTime;
+		
+		/**
+		 * Time in seconds each thread spent evaluating function values during the construction, including the computation
+		 * of the coordinates of the grid points. The i-th element belongs to the threads assigned to the i-th slot, see
+		 * MultiDimGrid::InstrumentationSlotNumber, and trailing slots without any time are omitted.
+		 */
+		std::vector<double> ThreadConstructionTimes;
+		
+		/**
+		 * Number of bytes of heap memory held by the function values and the storage layout tables. Function values
+		 * referring to a memory-mapped file do not count. Unlike the other members, it is also determined if the
+		 * instrumentation is disabled.
+		 */
+		std::uint64_t AllocatedBytes;
+	};
+	
+	/**
+	 * Snapshot of the instrumentation counters of a CoordinateAxis.
+	 */
+	struct CoordinateAxisCounters
+	{
+		/**
+		 * Number of coordinates checked to be within the range of the axis by its checked methods.
+		 */
+		std::uint64_t CoordinateChecks;
+		
+		/**
+		 * Number of axis points checked to be within the range of the axis by its checked methods.
+		 */
+		std::uint64_t AxisPointChecks;
+	};
+	
+	/**
+	 * \brief Set of \a CounterNumber event counters of an instrumented object.
+	 * 
+	 * Every thread adds to its own slot of each counter without synchronizing with other threads, and the totals are
+	 * only formed when the counters are read. The slot of each thread fills whole cache lines of 64 bytes, so that
+	 * threads never write to the same cache line. Copies of an instrumented object start with counters of zero, as the
+	 * counts belong to the object they were collected by.
+	 * 
+	 * If MultiDimGrid::InstrumentationEnabled is false, this class holds no data and all its methods do nothing.
+	 */
+	template <std::size_t CounterNumber>
+	class InstrumentationCounters
+	{
+	public:
+		/**
+		 * Constructor instantiating a set of counters of zero.
+		 */
+		InstrumentationCounters ();
+		
+		/**
+		 * Copy-constructor instantiating a set of counters of zero, independent of \a otherCounters.
+		 */
+		InstrumentationCounters (const InstrumentationCounters& otherCounters);
+		
+		/**
+		 * Default move-constructor, taking over the counts of \a otherCounters. \a otherCounters is left without counts,
+		 * such that it ignores additions and reports zero until it is assigned to.
+		 */
+		InstrumentationCounters (InstrumentationCounters&& otherCounters) = default;
+		
+		/**
+		 * Assignment operator resetting all counters to zero, independent of \a otherCounters.
+		 */
+		InstrumentationCounters& operator= (const InstrumentationCounters& otherCounters);
+		
+		/**
+		 * Default move-assignment operator, taking over the counts of \a otherCounters, which is left without counts as
+		 * described for the move-constructor.
+		 */
+		InstrumentationCounters& operator= (InstrumentationCounters&& otherCounters) = default;
+		
+		/**
+		 * Adds \a amount to the counter with index \a i_counter within the slot of the calling thread.
+		 */
+		void add (std::size_t i_counter, std::uint64_t amount);
+		
+		/**
+		 * Returns the value of the counter with index \a i_counter summed over all slots.
+		 */
+		std::uint64_t total (std::size_t i_counter) const;
+		
+		/**
+		 * Returns the values of the counter with index \a i_counter in each slot, omitting trailing slots with a value
+		 * of zero.
+		 */
+		std::vector<std::uint64_t> slot_values (std::size_t i_counter) const;
+		
+		/**
+		 * Resets all counters to zero.
+		 * 
+		 * Additions by other threads during the reset may or may not be included in the counts afterwards.
+		 */
+		void reset ();
+	
+	#ifdef MULTIDIMGRID_INSTRUMENTATION
+	private:
+		/**
+		 * Distance between the slots of a counter in MultiDimGrid::InstrumentationCounters::Counts, which is rounded
+		 * up to fill whole cache lines of 64 bytes.
+		 */
+		static constexpr std::size_t SlotStride = (CounterNumber + 7) / 8 * 8;
+		
+		/**
+		 * Alignment of MultiDimGrid::InstrumentationCounters::Counts in bytes, which is the size of a cache line.
+		 */
+		static constexpr std::size_t CountAlignment = 64;
+		
+		/**
+		 * Counts of all counters, stored slot by slot and released with \c free.
+		 */
+		std::unique_ptr<std::atomic<std::uint64_t>[], void (*)(void*)> Counts;
+		
+		/**
+		 * Allocates and returns the storage for MultiDimGrid::InstrumentationCounters::Counts, aligned to
+		 * MultiDimGrid::InstrumentationCounters::CountAlignment bytes. If that fails, an error message is written to the
+		 * standard output and the program is terminated.
+		 */
+		static std::atomic<std::uint64_t>* allocate_counts ();
+	#endif
+	};
+	
+	/**
+	 * Returns the slot of the calling thread, which is assigned when a thread first updates any counter.
+	 */
+	std::size_t instrumentation_thread_slot ();
+	
+	/**
+	 * Returns the current time in nanoseconds since an arbitrary but fixed point in time, as measured by a monotonic
+	 * clock.
+	 */
+	std::uint64_t instrumentation_time ();
+}
+
+#include "Instrumentation.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
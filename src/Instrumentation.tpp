@@ -0,0 +1,190 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+#ifdef MULTIDIMGRID_INSTRUMENTATION
+
+template <std::size_t CounterNumber>
+constexpr std::size_t MultiDimGrid::InstrumentationCounters<CounterNumber>::SlotStride;
+
+template <std::size_t CounterNumber>
+constexpr std::size_t MultiDimGrid::InstrumentationCounters<CounterNumber>::CountAlignment;
+
+template <std::size_t CounterNumber>
+MultiDimGrid::InstrumentationCounters<CounterNumber>::InstrumentationCounters () :
+	Counts(allocate_counts(), free)
+{
+	reset();
+}
+
+template <std::size_t CounterNumber>
+MultiDimGrid::InstrumentationCounters<CounterNumber>::InstrumentationCounters (const InstrumentationCounters&) :
+	InstrumentationCounters()
+{}
+
+template <std::size_t CounterNumber>
+MultiDimGrid::InstrumentationCounters<CounterNumber>& MultiDimGrid::InstrumentationCounters<CounterNumber>::operator= (const InstrumentationCounters&)
+{
+	if ( !Counts )	// a moved-from set of counters is given new storage
+	{
+		Counts = std::unique_ptr<std::atomic<std::uint64_t>[], void (*)(void*)>(allocate_counts(), free);
+	}
+	
+	reset();
+	
+	return *this;
+}
+
+template <std::size_t CounterNumber>
+void MultiDimGrid::InstrumentationCounters<CounterNumber>::add (const std::size_t i_counter, const std::uint64_t amount)
+{
+	if ( !Counts )	// a moved-from set of counters counts nothing, like the counters of an uninstrumented build
+	{
+		return;
+	}
+	
+	const std::size_t threadSlot = instrumentation_thread_slot();
+	
+	std::atomic<std::uint64_t>& count = Counts[threadSlot * SlotStride + i_counter];
+	
+	if ( threadSlot + 1 < InstrumentationSlotNumber )	// all slots but the last one are owned by a single thread, which can add to its count without a read-modify-write operation
+	{
+		count.store(count.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+	}
+	else
+	{
+		count.fetch_add(amount, std::memory_order_relaxed);
+	}
+}
+
+template <std::size_t CounterNumber>
+std::uint64_t MultiDimGrid::InstrumentationCounters<CounterNumber>::total (const std::size_t i_counter) const
+{
+	std::uint64_t totalValue = 0;
+	
+	if ( !Counts )
+	{
+		return totalValue;
+	}
+	
+	for ( std::size_t i_slot = 0; i_slot < InstrumentationSlotNumber; ++i_slot )
+	{
+		totalValue += Counts[i_slot * SlotStride + i_counter].load(std::memory_order_relaxed);
+	}
+	
+	return totalValue;
+}
+
+template <std::size_t CounterNumber>
+std::vector<std::uint64_t> MultiDimGrid::InstrumentationCounters<CounterNumber>::slot_values (const std::size_t i_counter) const
+{
+	std::vector<std::uint64_t> slotValues;
+	
+	if ( !Counts )
+	{
+		return slotValues;
+	}
+	
+	for ( std::size_t i_slot = 0; i_slot < InstrumentationSlotNumber; ++i_slot )
+	{
+		slotValues.push_back( Counts[i_slot * SlotStride + i_counter].load(std::memory_order_relaxed) );
+	}
+	
+	while ( !slotValues.empty() && (slotValues.back() == 0) )
+	{
+		slotValues.pop_back();
+	}
+	
+	return slotValues;
+}
+
+template <std::size_t CounterNumber>
+void MultiDimGrid::InstrumentationCounters<CounterNumber>::reset ()
+{
+	if ( !Counts )
+	{
+		return;
+	}
+	
+	for ( std::size_t i_count = 0; i_count < InstrumentationSlotNumber * SlotStride; ++i_count )
+	{
+		Counts[i_count].store(0, std::memory_order_relaxed);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <std::size_t CounterNumber>
+std::atomic<std::uint64_t>* MultiDimGrid::InstrumentationCounters<CounterNumber>::allocate_counts ()
+{
+	const std::size_t countNumber = InstrumentationSlotNumber * SlotStride;
+	
+	void* memory = nullptr;
+	
+	if ( posix_memalign(&memory, CountAlignment, countNumber * sizeof(std::atomic<std::uint64_t>)) != 0 )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::InstrumentationCounters Error: Could not allocate memory" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+	
+	std::atomic<std::uint64_t>* const counts = static_cast<std::atomic<std::uint64_t>*>(memory);
+	
+	for ( std::size_t i_count = 0; i_count < countNumber; ++i_count )	// the counts are trivially destructible, so releasing the memory is sufficient
+	{
+		new (counts + i_count) std::atomic<std::uint64_t>(0);
+	}
+	
+	return counts;
+}
+
+#else
+
+template <std::size_t CounterNumber>
+MultiDimGrid::InstrumentationCounters<CounterNumber>::InstrumentationCounters ()
+{}
+
+template <std::size_t CounterNumber>
+MultiDimGrid::InstrumentationCounters<CounterNumber>::InstrumentationCounters (const InstrumentationCounters&)
+{}
+
+template <std::size_t CounterNumber>
+MultiDimGrid::InstrumentationCounters<CounterNumber>& MultiDimGrid::InstrumentationCounters<CounterNumber>::operator= (const InstrumentationCounters&)
+{
+	return *this;
+}
+
+template <std::size_t CounterNumber>
+void MultiDimGrid::InstrumentationCounters<CounterNumber>::add (const std::size_t, const std::uint64_t)
+{}
+
+template <std::size_t CounterNumber>
+std::uint64_t MultiDimGrid::InstrumentationCounters<CounterNumber>::total (const std::size_t) const
+{
+	return 0;
+}
+
+template <std::size_t CounterNumber>
+std::vector<std::uint64_t> MultiDimGrid::InstrumentationCounters<CounterNumber>::slot_values (const std::size_t) const
+{
+	return std::vector<std::uint64_t>();
+}
+
+template <std::size_t CounterNumber>
+void MultiDimGrid::InstrumentationCounters<CounterNumber>::reset ()
+{}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,115 @@
+#ifndef MULTIDIMGRID_INTERPOLATION_CURSOR_H
+#define MULTIDIMGRID_INTERPOLATION_CURSOR_H
+
+#include "CoordinateGrid.hpp"
+#include "GridFunction.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace MultiDimGrid
+{
+	/**
+	 * \brief Class providing the interpolation of a GridFunction along a stream of coordinates that only move slightly
+	 * from one interpolation to the next, e.g. along the trajectory of an ODE integrator or a particle tracker.
+	 * 
+	 * The cursor remembers the grid cell of the last interpolation together with the function values at its corners.
+	 * If the next coordinates lie within the same cell, only the interpolation weights are recomputed, while none of the
+	 * 2^\a Dim function values has to be gathered from the grid function again. Otherwise, the function values at the
+	 * corners of the new cell are gathered and remembered instead. The cell is always located from scratch, since all
+	 * coordinate axes map coordinates to axis points in closed form, so walking from the last cell would not be cheaper.
+	 * 
+	 * A cursor hence pays off if several consecutive coordinates lie within the same grid cell, e.g. for the substeps
+	 * of an ODE integrator. If nearly every coordinate lies within a different cell, GridFunction::interpolate is
+	 * slightly faster, as it does not need to branch on whether the cell has changed.
+	 * 
+	 * A cursor only refers to the grid function it was created for, which hence has to outlive it and must not be moved
+	 * or assigned to in the meantime. If the function values of the grid function are modified, InterpolationCursor::reset
+	 * has to be called before the next interpolation. A cursor is cheap to create, but is not safe to be used by several
+	 * threads concurrently, so each thread should create its own.
+	 */
+	template <std::size_t Dim, class Value = double>
+	class InterpolationCursor
+	{
+	public:
+		/**
+		 * Constructor instantiating a cursor for the interpolation of the GridFunction \a gridFunc, which does not remember
+		 * any grid cell yet.
+		 */
+		explicit InterpolationCursor (const GridFunction<Dim, Value>& gridFunc);
+		
+		/**
+		 * Returns the interpolated function value of the grid function at the coordinates \a coords, which is the same
+		 * as the one returned by GridFunction::interpolate.
+		 */
+		double interpolate (const Coordinates<Dim>& coords);
+		
+		/**
+		 * Returns the interpolated function value of the grid function at the coordinates \a coords, which is the same
+		 * as the one returned by GridFunction::interpolate.
+		 * 
+		 * In contrast to InterpolationCursor::interpolate, this method does not check if \a coords is within the range
+		 * of the grid. It is thus slightly faster, but unsafe!
+		 */
+		double interpolate_unchecked (const Coordinates<Dim>& coords);
+		
+		/**
+		 * Overloads the paranthesis operator to return the interpolated function value of the grid function at the
+		 * coordinates \a coords.
+		 * 
+		 * This provides the same functionality as InterpolationCursor::interpolate.
+		 */
+		double operator() (const Coordinates<Dim>& coords);
+		
+		/**
+		 * Makes the cursor forget the grid cell of the last interpolation, such that the function values at the corners
+		 * of the next one are loaded anew. This has to be called after the function values of the grid function have been
+		 * modified.
+		 */
+		void reset ();
+		
+		/**
+		 * Returns a reference to the grid function interpolated by the cursor.
+		 */
+		const GridFunction<Dim, Value>& grid_function () const;
+	
+	protected:
+	
+	private:
+		/**
+		 * Number of corners of a grid cell.
+		 */
+		static constexpr std::size_t CornerNumber = GridFunction<Dim, Value>::CornerNumber;
+		
+		/**
+		 * Grid function interpolated by the cursor.
+		 */
+		const GridFunction<Dim, Value>* GridFunc;
+		
+		/**
+		 * Lower axis points of the grid cell of the last interpolation along each axis.
+		 */
+		GridPoint<Dim> CellAxisPoints;
+		
+		/**
+		 * Whether the cursor remembers the grid cell of the last interpolation.
+		 */
+		bool HasCell;
+		
+		/**
+		 * Function values at the corners of the grid cell of the last interpolation, ordered as described in
+		 * CoordinateGrid::CornerOffsets.
+		 */
+		std::array<double, CornerNumber> CornerValues;
+		
+		/**
+		 * Makes the grid cell whose lower axis points are \a cellAxisPoints the remembered one and gathers the function
+		 * values at its corners.
+		 */
+		void move_to_cell (const GridPoint<Dim>& cellAxisPoints);
+	};
+}
+
+#include "InterpolationCursor.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include <array>
+#include <cstddef>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::InterpolationCursor<Dim, Value>::InterpolationCursor (const GridFunction<Dim, Value>& gridFunc) :
+	GridFunc(&gridFunc),
+	HasCell(false)
+{
+	CellAxisPoints.fill(0);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::InterpolationCursor<Dim, Value>::interpolate (const Coordinates<Dim>& coords)
+{
+	GridFunc->check_coordinates(coords, "InterpolationCursor::interpolate");
+	
+	GridFunc->Counters.add(GridFunction<Dim, Value>::CheckedInterpolationCounter, 1);
+	
+	return interpolate_unchecked(coords);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::InterpolationCursor<Dim, Value>::interpolate_unchecked (const Coordinates<Dim>& coords)
+{
+	GridFunc->Counters.add(GridFunction<Dim, Value>::InterpolationCounter, 1);
+	
+	DoubleArray<Dim> interpolationWeights;
+	
+	GridPoint<Dim> cellAxisPoints;
+	
+	bool isSameCell = HasCell;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// the cell and the weights are located exactly as by the grid function itself, so that the interpolated values agree
+	{
+		cellAxisPoints[i_axis] = GridFunc->locate_cell_axis_point(i_axis, coords[i_axis], interpolationWeights[i_axis]);
+		
+		isSameCell &= (cellAxisPoints[i_axis] == CellAxisPoints[i_axis]);
+	}
+	
+	if ( !isSameCell )
+	{
+		move_to_cell(cellAxisPoints);
+	}
+	
+	std::array<double, CornerNumber / 2> halvedCornerValues;	// the remembered corner values are still needed for the next interpolation, so the sweep is carried out in this scratch array
+	
+	return GridFunc->interpolate_corner_values(CornerValues.data(), halvedCornerValues.data(), interpolationWeights);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::InterpolationCursor<Dim, Value>::operator() (const Coordinates<Dim>& coords)
+{
+	return interpolate(coords);
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::InterpolationCursor<Dim, Value>::reset ()
+{
+	HasCell = false;
+}
+
+template <std::size_t Dim, class Value>
+const MultiDimGrid::GridFunction<Dim, Value>& MultiDimGrid::InterpolationCursor<Dim, Value>::grid_function () const
+{
+	return *GridFunc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::InterpolationCursor<Dim, Value>::move_to_cell (const GridPoint<Dim>& cellAxisPoints)
+{
+	GridFunc->gather_cell_corner_values(cellAxisPoints, CornerValues.data());
+	
+	CellAxisPoints = cellAxisPoints;
+	HasCell = true;
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+#ifndef MULTIDIMGRID_LAZY_GRID_FUNCTION_H
+#define MULTIDIMGRID_LAZY_GRID_FUNCTION_H
+
+#include "CoordinateGrid.hpp"
+#include "FunctionValueBuffer.hpp"
+#include "GridFunction.hpp"
+#include "Parallelization.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace MultiDimGrid
+{
+	/**
+	 * \brief Class providing a discrete function defined on a multi-dimensional coordinate grid, whose function values
+	 * are only computed when they are first needed.
+	 * 
+	 * In contrast to GridFunction, the function to be discretized is not evaluated at all grid points on construction.
+	 * Instead, the function value at a grid point is computed the first time it is accessed, either directly or as a
+	 * corner of the grid cell used in an interpolation, and then stored for all further accesses. If only a small region
+	 * of the grid is ever used, this saves most of the evaluations.
+	 * 
+	 * All methods are safe to call concurrently. The state of each grid point is held in an atomic flag, such that every
+	 * function value is computed exactly once, by the first thread accessing it, while other threads needing the same
+	 * value wait for it. The function has hence to be safe to call concurrently if the LazyGridFunction is used by several
+	 * threads.
+	 * 
+	 * If the function throws an exception, the grid point is released again and the exception propagates to the caller,
+	 * which may retry the access. This only helps callers outside of OpenMP parallel regions: An exception thrown while
+	 * LazyGridFunction::interpolate_many, LazyGridFunction::interpolate_many_unchecked or
+	 * LazyGridFunction::grid_function run with a schedule other than ParallelSchedule::Serial can not leave the parallel
+	 * region and hence terminates the program via \c std::terminate.
+	 * 
+	 * As for GridFunction, the function values are stored as \a Value, while interpolations are carried out in \c double
+	 * precision.
+	 */
+	template <std::size_t Dim, class Value = double>
+	class LazyGridFunction : public CoordinateGrid<Dim>
+	{
+	public:
+		/**
+		 * Constructor instantiating a discrete function defined on a grid spanned up by several coordinate axes pointed
+		 * to by the \a coordAxisPointers, whose function value at each grid point will be set to the value of the MultiDimGrid::Function
+		 * \a func at the coordinates of this grid point on first access. \a func is copied.
+		 * 
+		 * The function values are allocated according to the storage policy \a policy. They are first written by the
+		 * evaluations, so each memory page is placed on the NUMA node of the thread that first accesses one of its grid
+		 * points.
+		 */
+		LazyGridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const Function<Dim>& func, const StoragePolicy& policy = DefaultStoragePolicy);
+		
+		/**
+		 * Returns the function value at the grid point \a gridPoint, computing it if this has not been done before.
+		 */
+		double value (const GridPoint<Dim>& gridPoint) const;
+		
+		/**
+		 * Returns the function value at the grid point with index \a index, computing it if this has not been done before.
+		 */
+		double value_at_index (std::size_t index) const;
+		
+		/**
+		 * Returns the function value at the grid point with index \a index, computing it if this has not been done before.
+		 * 
+		 * In contrast to LazyGridFunction::value_at_index, this method does not check if \a index is within the range of
+		 * the grid. It is thus slightly faster, but unsafe!
+		 */
+		double value_at_index_unchecked (std::size_t index) const;
+		
+		/**
+		 * Returns the interpolated function value of the discrete function at the coordinates \a coords, computing the
+		 * function values at the corners of the surrounding grid cell if this has not been done before.
+		 */
+		double interpolate (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Returns the interpolated function value of the discrete function at the coordinates \a coords, computing the
+		 * function values at the corners of the surrounding grid cell if this has not been done before.
+		 * 
+		 * In contrast to LazyGridFunction::interpolate, this method does not check if \a coords is within the range of
+		 * the grid. It is thus slightly faster, but unsafe!
+		 */
+		double interpolate_unchecked (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Overloads the paranthesis operator to return the interpolated function value of the discrete function at the
+		 * coordinates \a coords.
+		 * 
+		 * This provides the same functionality as LazyGridFunction::interpolate.
+		 */
+		double operator() (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Computes the interpolated function values of the discrete function at the \a number coordinates stored in the
+		 * array \a coords and writes them to the array \a values, which has to be of the same length. The interpolations,
+		 * including the computations of the required function values, are distributed among OpenMP threads according
+		 * to \a schedule.
+		 */
+		void interpolate_many (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Computes the interpolated function values of the discrete function at the \a number coordinates stored in the
+		 * array \a coords and writes them to the array \a values, which has to be of the same length.
+		 * 
+		 * In contrast to LazyGridFunction::interpolate_many, this method does not check if \a coords are within the range
+		 * of the grid. It is thus slightly faster, but unsafe!
+		 */
+		void interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns \c true if the function value at the grid point with index \a index has already been computed.
+		 */
+		bool is_evaluated (std::size_t index) const;
+		
+		/**
+		 * Returns the number of grid points whose function values have been computed so far.
+		 */
+		std::size_t evaluated_point_number () const;
+		
+		/**
+		 * Returns the fraction of grid points whose function values have been computed so far.
+		 */
+		double evaluated_fraction () const;
+		
+		/**
+		 * Computes all function values that have not been computed so far, distributing the computations among OpenMP
+		 * threads according to \a schedule, and returns a GridFunction with all function values, which is defined on
+		 * the same coordinate axes, shared rather than copied. The function values are allocated according to the storage
+		 * policy of this lazy grid function.
+		 */
+		GridFunction<Dim, Value> grid_function (ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Deleted copy-constructor, as the states of the grid points can not be copied consistently while they might be
+		 * changed concurrently.
+		 */
+		LazyGridFunction (const LazyGridFunction& otherLazyGridFunction) = delete;
+		
+		/**
+		 * Default move-constructor.
+		 */
+		LazyGridFunction (LazyGridFunction&& otherLazyGridFunction) = default;
+		
+		/**
+		 * Deleted assignment operator.
+		 */
+		LazyGridFunction& operator= (const LazyGridFunction& otherLazyGridFunction) = delete;
+		
+		/**
+		 * Default move-assignment operator.
+		 */
+		LazyGridFunction& operator= (LazyGridFunction&& otherLazyGridFunction) = default;
+	
+	protected:
+	
+	private:
+		using CoordinateGrid<Dim>::CornerNumber;
+		using CoordinateGrid<Dim>::CoordAxes;
+		using CoordinateGrid<Dim>::IndexStrides;
+		using CoordinateGrid<Dim>::CornerOffsets;
+		using CoordinateGrid<Dim>::GridPointNumber;
+		using CoordinateGrid<Dim>::locate_cell;
+		using CoordinateGrid<Dim>::interpolate_corner_values;
+		using CoordinateGrid<Dim>::check_axis_point;
+		using CoordinateGrid<Dim>::check_coordinates;
+		using CoordinateGrid<Dim>::check_index;
+		
+		/**
+		 * States of the function value at a grid point.
+		 */
+		enum class PointState : std::uint8_t
+		{
+			Unevaluated,
+			Evaluating,
+			Evaluated
+		};
+		
+		/**
+		 * Function to be discretized.
+		 */
+		Function<Dim> Func;
+		
+		/**
+		 * Function values at each grid point, stored in the nested fashion described in GridFunction::FunctionValues.
+		 * Only the values of grid points in the state PointState::Evaluated are valid.
+		 */
+		mutable FunctionValueBuffer<Value> FunctionValues;
+		
+		/**
+		 * States of the function values at each grid point, stored in the same fashion as the function values.
+		 */
+		std::unique_ptr<std::atomic<PointState>[]> PointStates;
+		
+		/**
+		 * Returns the function value at the grid point with index \a index, which is computed first if this has not
+		 * been done before.
+		 */
+		double evaluated_value (std::size_t index) const;
+		
+		/**
+		 * Computes the function value at the grid point with index \a index if no other thread has started doing so, and
+		 * otherwise waits until the other thread has finished.
+		 * 
+		 * If the function throws an exception, the grid point is reset to PointState::Unevaluated before the exception
+		 * is rethrown, such that the next access, possibly by a waiting thread, computes the function value anew.
+		 */
+		void evaluate_point (std::size_t index) const;
+	};
+}
+
+#include "LazyGridFunction.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
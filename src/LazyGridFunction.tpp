@@ -0,0 +1,204 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::LazyGridFunction<Dim, Value>::LazyGridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const Function<Dim>& func, const StoragePolicy& policy) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Func(func),
+	FunctionValues(GridPointNumber, policy),	// the uninitialized function values are first written by the evaluations
+	PointStates(new std::atomic<PointState>[GridPointNumber])
+{
+	static_assert(Dim != 0, "MultiDimGrid::LazyGridFunction Error: Number of dimensions is zero");
+	
+	for ( std::size_t index = 0; index < GridPointNumber; ++index )	// atomics are not initialized by default
+	{
+		PointStates[index].store(PointState::Unevaluated, std::memory_order_relaxed);
+	}
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::LazyGridFunction<Dim, Value>::value (const GridPoint<Dim>& gridPoint) const
+{
+	std::size_t index = 0;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const std::size_t axisPoint = gridPoint[i_axis];
+		
+		check_axis_point(axisPoint, CoordAxes[i_axis].get(), "LazyGridFunction::value");
+		
+		index += axisPoint * IndexStrides[i_axis];
+	}
+	
+	return evaluated_value(index);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::LazyGridFunction<Dim, Value>::value_at_index (const std::size_t index) const
+{
+	check_index(index, "LazyGridFunction::value_at_index");
+	
+	return evaluated_value(index);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::LazyGridFunction<Dim, Value>::value_at_index_unchecked (const std::size_t index) const
+{
+	return evaluated_value(index);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::LazyGridFunction<Dim, Value>::interpolate (const Coordinates<Dim>& coords) const
+{
+	check_coordinates(coords, "LazyGridFunction::interpolate");
+	
+	return interpolate_unchecked(coords);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::LazyGridFunction<Dim, Value>::interpolate_unchecked (const Coordinates<Dim>& coords) const
+{
+	DoubleArray<Dim> interpolationWeights;
+	
+	const std::size_t cellIndex = locate_cell(coords, interpolationWeights);
+	
+	std::array<double, CornerNumber> cornerValues;
+	
+	for ( std::size_t i_corner = 0; i_corner < CornerNumber; ++i_corner )	// only the corners of this grid cell need to be evaluated
+	{
+		cornerValues[i_corner] = evaluated_value(cellIndex + CornerOffsets[i_corner]);
+	}
+	
+	return interpolate_corner_values(cornerValues.data(), interpolationWeights);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::LazyGridFunction<Dim, Value>::operator() (const Coordinates<Dim>& coords) const
+{
+	return interpolate(coords);
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::LazyGridFunction<Dim, Value>::interpolate_many (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, values] (const std::size_t i_coords)
+	{
+		values[i_coords] = interpolate(coords[i_coords]);
+	});
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::LazyGridFunction<Dim, Value>::interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, values] (const std::size_t i_coords)
+	{
+		values[i_coords] = interpolate_unchecked(coords[i_coords]);
+	});
+}
+
+template <std::size_t Dim, class Value>
+bool MultiDimGrid::LazyGridFunction<Dim, Value>::is_evaluated (const std::size_t index) const
+{
+	check_index(index, "LazyGridFunction::is_evaluated");
+	
+	return ( PointStates[index].load(std::memory_order_acquire) == PointState::Evaluated );
+}
+
+template <std::size_t Dim, class Value>
+std::size_t MultiDimGrid::LazyGridFunction<Dim, Value>::evaluated_point_number () const
+{
+	std::size_t evaluatedPointNumber = 0;
+	
+	for ( std::size_t index = 0; index < GridPointNumber; ++index )	// counting the states on demand keeps the accesses free of a shared counter
+	{
+		if ( PointStates[index].load(std::memory_order_relaxed) == PointState::Evaluated )
+		{
+			++evaluatedPointNumber;
+		}
+	}
+	
+	return evaluatedPointNumber;
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::LazyGridFunction<Dim, Value>::evaluated_fraction () const
+{
+	return static_cast<double>(evaluated_point_number()) / GridPointNumber;
+}
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::GridFunction<Dim, Value> MultiDimGrid::LazyGridFunction<Dim, Value>::grid_function (const ParallelSchedule schedule) const
+{
+	FunctionValueBuffer<Value> funcValues(GridPointNumber, FunctionValues.storage_policy());	// the uninitialized function values are first written by the same threads that compute them
+	
+	parallel_for(GridPointNumber, schedule, [this, &funcValues] (const std::size_t index)
+	{
+		if ( PointStates[index].load(std::memory_order_acquire) != PointState::Evaluated )
+		{
+			evaluate_point(index);
+		}
+		
+		funcValues[index] = FunctionValues[index];
+	});
+	
+	return GridFunction<Dim, Value>(CoordAxes, std::move(funcValues));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::LazyGridFunction<Dim, Value>::evaluated_value (const std::size_t index) const
+{
+	if ( PointStates[index].load(std::memory_order_acquire) != PointState::Evaluated )	// after the first access, only this check remains
+	{
+		evaluate_point(index);
+	}
+	
+	return FunctionValues[index];
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::LazyGridFunction<Dim, Value>::evaluate_point (const std::size_t index) const
+{
+	std::atomic<PointState>& pointState = PointStates[index];
+	
+	while ( true )
+	{
+		PointState expectedState = PointState::Unevaluated;
+		
+		if ( pointState.compare_exchange_strong(expectedState, PointState::Evaluating, std::memory_order_acquire) )	// only the thread that claims the grid point computes its function value
+		{
+			try
+			{
+				FunctionValues[index] = Func( this->coordinates_at_index_unchecked(index) );
+			}
+			catch (...)
+			{
+				pointState.store(PointState::Unevaluated, std::memory_order_release);	// releases the claim, so that the grid point is not left in evaluation forever
+				
+				throw;
+			}
+			
+			pointState.store(PointState::Evaluated, std::memory_order_release);	// publishes the function value to all threads that subsequently find the grid point evaluated
+			
+			return;
+		}
+		
+		if ( expectedState == PointState::Evaluated )
+		{
+			return;
+		}
+		
+		std::this_thread::yield();	// another thread is computing the function value; if it fails, this thread claims the grid point instead
+	}
+}
\ No newline at end of file
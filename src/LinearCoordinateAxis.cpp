@@ -11,7 +11,8 @@
 MultiDimGrid::LinearCoordinateAxis::LinearCoordinateAxis (const double lowerCoordinateLimit, const double upperCoordinateLimit, const std::size_t intervalNumber) :
 	CoordinateAxis(lowerCoordinateLimit, upperCoordinateLimit, intervalNumber),
 	Coordinates(),
-	IntegrationWeights()
+	IntegrationWeights(),
+	InverseIntervalWidth( IntervalNumber / (upperCoordinateLimit - lowerCoordinateLimit) )
 {
 	if ( IntervalNumber == 0 )
 	{
@@ -36,33 +37,21 @@ double MultiDimGrid::LinearCoordinateAxis::integration_weight_unchecked (const s
 	return IntegrationWeights[axisPoint];
 }
 
-double MultiDimGrid::LinearCoordinateAxis::interpolation_weight_unchecked (const double coord) const
+MultiDimGrid::AxisLocation MultiDimGrid::LinearCoordinateAxis::locate_unchecked (const double coord) const
 {
-	const double nearestSmallerCoordinate = coordinate_unchecked( nearest_lower_axis_point_unchecked(coord) );
-	const double nearestLargerCoordinate = coordinate_unchecked( nearest_higher_axis_point_unchecked(coord) );
+	const double interpolatedAxisPoint = (coord - LowerCoordinateLimit) * InverseIntervalWidth;	// inverse the mapping from axis points to coordinate values
 	
-	if ( nearestSmallerCoordinate < nearestLargerCoordinate )
-	{
-		return (coord - nearestSmallerCoordinate) / (nearestLargerCoordinate - nearestSmallerCoordinate);	// the linear interpolation weight is given by the coordinate distance to the nearest lower axis point relative to the coordinate distance between the two neighbouring axis points
-	}
-	else
-	{
-		return 0.0;
-	}
+	return locate_interpolated_axis_point(interpolatedAxisPoint);
 }
 
-std::size_t MultiDimGrid::LinearCoordinateAxis::nearest_lower_axis_point_unchecked (const double coord) const
+double MultiDimGrid::LinearCoordinateAxis::interpolation_weight_derivative_unchecked (const double coord) const
 {
-	const double interpolatedAxisPoint = (coord - LowerCoordinateLimit) / ( UpperCoordinateLimit - LowerCoordinateLimit ) * IntervalNumber;	// inverse the mapping from axis points to coordinate values
-	
-	return std::size_t( std::floor(interpolatedAxisPoint) );	// round down the interpolated axis point
+	return InverseIntervalWidth;
 }
 
-std::size_t MultiDimGrid::LinearCoordinateAxis::nearest_higher_axis_point_unchecked (const double coord) const
+MultiDimGrid::AxisDescription MultiDimGrid::LinearCoordinateAxis::description () const
 {
-	const double interpolatedAxisPoint = (coord - LowerCoordinateLimit) / ( UpperCoordinateLimit - LowerCoordinateLimit ) * IntervalNumber;	// inverse the mapping from axis points to coordinate values
-	
-	return std::size_t( std::ceil(interpolatedAxisPoint) );	// round up the interpolated axis point
+	return {AxisType::Linear, LowerCoordinateLimit, UpperCoordinateLimit, 0.0, IntervalNumber, 0};
 }
 
 MultiDimGrid::LinearCoordinateAxis* MultiDimGrid::LinearCoordinateAxis::clone () const
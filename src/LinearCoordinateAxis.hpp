@@ -28,11 +28,11 @@ namespace MultiDimGrid
 		
 		double integration_weight_unchecked (std::size_t axisPoint) const;
 		
-		double interpolation_weight_unchecked (double coord) const;
+		AxisLocation locate_unchecked (double coord) const;
 		
-		std::size_t nearest_lower_axis_point_unchecked (double coord) const;
+		double interpolation_weight_derivative_unchecked (double coord) const;
 		
-		std::size_t nearest_higher_axis_point_unchecked (double coord) const;
+		AxisDescription description () const;
 		
 		LinearCoordinateAxis* clone () const;
 	
@@ -47,6 +47,11 @@ namespace MultiDimGrid
 		 */
 		std::vector<double> IntegrationWeights;
 		
+		/**
+		 * Reciprocal of the coordinate distance between neighbouring axis points.
+		 */
+		double InverseIntervalWidth;
+		
 		/**
 		 * Initializes the values of the coordinates in LinearCoordinateAxis::Coordinates.
 		 */
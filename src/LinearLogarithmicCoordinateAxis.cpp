@@ -45,40 +45,38 @@ double MultiDimGrid::LinearLogarithmicCoordinateAxis::integration_weight_uncheck
 	}
 }
 
-double MultiDimGrid::LinearLogarithmicCoordinateAxis::interpolation_weight_unchecked (const double coord) const
+MultiDimGrid::AxisLocation MultiDimGrid::LinearLogarithmicCoordinateAxis::locate_unchecked (const double coord) const
 {
 	if ( coord > SpacingThresholdValue )
 	{
-		return LogAxis.interpolation_weight_unchecked(coord);
+		AxisLocation location = LogAxis.locate_unchecked(coord);
+		
+		location.LowerAxisPoint += LinearIntervalNumber;	// the axis points of the logarithmic part follow the ones of the linear part
+		location.HigherAxisPoint += LinearIntervalNumber;
+		
+		return location;
 	}
 	else
 	{
-		return LinAxis.interpolation_weight_unchecked(coord);
+		return LinAxis.locate_unchecked(coord);
 	}
 }
 
-std::size_t MultiDimGrid::LinearLogarithmicCoordinateAxis::nearest_lower_axis_point_unchecked (const double coord) const
+double MultiDimGrid::LinearLogarithmicCoordinateAxis::interpolation_weight_derivative_unchecked (const double coord) const
 {
-	if ( coord > SpacingThresholdValue )
+	if ( coord > SpacingThresholdValue )	// the same case distinction as in 'locate_unchecked', so that the derivative belongs to the same interpolation
 	{
-		return LogAxis.nearest_lower_axis_point_unchecked(coord) + LinearIntervalNumber;
+		return LogAxis.interpolation_weight_derivative_unchecked(coord);
 	}
 	else
 	{
-		return LinAxis.nearest_lower_axis_point_unchecked(coord);
+		return LinAxis.interpolation_weight_derivative_unchecked(coord);
 	}
 }
 
-std::size_t MultiDimGrid::LinearLogarithmicCoordinateAxis::nearest_higher_axis_point_unchecked (const double coord) const
+MultiDimGrid::AxisDescription MultiDimGrid::LinearLogarithmicCoordinateAxis::description () const
 {
-	if ( coord > SpacingThresholdValue )
-	{
-		return LogAxis.nearest_higher_axis_point_unchecked(coord) + LinearIntervalNumber;
-	}
-	else
-	{
-		return LinAxis.nearest_higher_axis_point_unchecked(coord);
-	}
+	return {AxisType::LinearLogarithmic, LowerCoordinateLimit, UpperCoordinateLimit, SpacingThresholdValue, IntervalNumber, LinearIntervalNumber};
 }
 
 MultiDimGrid::LinearLogarithmicCoordinateAxis* MultiDimGrid::LinearLogarithmicCoordinateAxis::clone () const
@@ -25,6 +25,8 @@ MultiDimGrid::LogarithmicCoordinateAxis::LogarithmicCoordinateAxis (const double
 	LowerLogLimit = std::log10(lowerCoordinateLimit);
 	UpperLogLimit = std::log10(upperCoordinateLimit);
 	
+	InverseLogIntervalWidth = IntervalNumber / (UpperLogLimit - LowerLogLimit);
+	
 	initialize_coordinates();
 	initialize_integration_weights();
 }
@@ -39,39 +41,23 @@ double MultiDimGrid::LogarithmicCoordinateAxis::integration_weight_unchecked (co
 	return IntegrationWeights[axisPoint];
 }
 
-double MultiDimGrid::LogarithmicCoordinateAxis::interpolation_weight_unchecked (const double coord) const
+MultiDimGrid::AxisLocation MultiDimGrid::LogarithmicCoordinateAxis::locate_unchecked (const double coord) const
 {
 	const double logarithmicCoordinate = std::log10(coord);	// to interpolate logarithmically, one has to perform a change of variables
 	
-	const double nearestSmallerLog = std::log10( coordinate_unchecked( nearest_lower_axis_point_unchecked(coord) ) );
-	const double nearestLargerLog = std::log10( coordinate_unchecked( nearest_higher_axis_point_unchecked(coord) ) );
+	const double interpolatedAxisPoint = (logarithmicCoordinate - LowerLogLimit) * InverseLogIntervalWidth;	// inverse the mapping from axis points to coordinate values
 	
-	if ( nearestSmallerLog < nearestLargerLog )
-	{
-		return (logarithmicCoordinate - nearestSmallerLog) / (nearestLargerLog - nearestSmallerLog);	// then one can easily evaluate the corresponding linear interpolation weight
-	}
-	else
-	{
-		return 0.0;
-	}
+	return locate_interpolated_axis_point(interpolatedAxisPoint);
 }
 
-std::size_t MultiDimGrid::LogarithmicCoordinateAxis::nearest_lower_axis_point_unchecked (const double coord) const
+double MultiDimGrid::LogarithmicCoordinateAxis::interpolation_weight_derivative_unchecked (const double coord) const
 {
-	const double logarithmicCoordinate = std::log10(coord);
-	
-	const double interpolatedAxisPoint = (logarithmicCoordinate - LowerLogLimit) / ( UpperLogLimit - LowerLogLimit ) * IntervalNumber;	// inverse the mapping from axis points to coordinate values
-	
-	return std::size_t( std::floor(interpolatedAxisPoint) );	// round down the interpolated axis point
+	return InverseLogIntervalWidth / (coord * std::log(10.0));	// chain rule for the change of variables to the decadic logarithm of the coordinate
 }
 
-std::size_t MultiDimGrid::LogarithmicCoordinateAxis::nearest_higher_axis_point_unchecked (const double coord) const
+MultiDimGrid::AxisDescription MultiDimGrid::LogarithmicCoordinateAxis::description () const
 {
-	const double logarithmicCoordinate = std::log10(coord);
-	
-	const double interpolatedAxisPoint = (logarithmicCoordinate - LowerLogLimit) / ( UpperLogLimit - LowerLogLimit ) * IntervalNumber;	// inverse the mapping from axis points to coordinate values
-	
-	return std::size_t( std::ceil(interpolatedAxisPoint) );	// round up the interpolated axis point
+	return {AxisType::Logarithmic, LowerCoordinateLimit, UpperCoordinateLimit, 0.0, IntervalNumber, 0};
 }
 
 MultiDimGrid::LogarithmicCoordinateAxis* MultiDimGrid::LogarithmicCoordinateAxis::clone () const
@@ -0,0 +1,225 @@
+#ifndef MULTIDIMGRID_MULTI_FIELD_GRID_FUNCTION_H
+#define MULTIDIMGRID_MULTI_FIELD_GRID_FUNCTION_H
+
+#include "CoordinateGrid.hpp"
+#include "FunctionValueBuffer.hpp"
+#include "GridFunction.hpp"
+#include "Parallelization.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace MultiDimGrid
+{
+	/**
+	 * The values of all fields of a MultiFieldGridFunction at some coordinates are returned as a \c double \c std::array
+	 * of length \a FieldNumber.
+	 */
+	template <std::size_t FieldNumber>
+	using FieldValues = std::array<double, FieldNumber>;
+	
+	/**
+	 * Functions that shall be discretized into a MultiFieldGridFunction are expected to be of this form: They depend on
+	 * a reference to some MultiDimGrid::Coordinates<\a Dim> \a coords and return the values of all \a FieldNumber fields
+	 * as MultiDimGrid::FieldValues<\a FieldNumber>.
+	 */
+	template <std::size_t Dim, std::size_t FieldNumber>
+	using MultiFieldFunction = std::function<FieldValues<FieldNumber>(const Coordinates<Dim>& coords)>;
+	
+	/**
+	 * Memory layouts of the function values of a MultiFieldGridFunction.
+	 * 
+	 * In the FieldLayout::Interleaved layout the values of all fields at a grid point are adjacent in memory, which is
+	 * optimal if all fields are interpolated at once, as the values at each corner of a grid cell are then read from
+	 * the same cache line. In the FieldLayout::FieldMajor layout the values of each field form a contiguous block, which
+	 * is stored like the function values of a GridFunction.
+	 */
+	enum class FieldLayout
+	{
+		Interleaved,
+		FieldMajor
+	};
+	
+	/**
+	 * \brief Class providing several discrete functions, called fields, defined on the same multi-dimensional coordinate
+	 * grid.
+	 * 
+	 * Each grid point carries the values of all \a FieldNumber fields, which are stored as \a Value in the memory layout
+	 * chosen on construction. As all fields share one CoordinateGrid, an interpolation locates the grid cell containing
+	 * the coordinates and computes the interpolation weights only once and then combines the values of all fields at
+	 * the corners of the cell at once. This is considerably faster than interpolating \a FieldNumber separate GridFunction
+	 * instances, whose function values would furthermore be scattered over separate arrays.
+	 * 
+	 * The interpolation is multi-linear in the coordinate spacings and carried out in \c double precision, as in GridFunction.
+	 */
+	template <std::size_t Dim, std::size_t FieldNumber, class Value = double>
+	class MultiFieldGridFunction : public CoordinateGrid<Dim>
+	{
+	public:
+		/**
+		 * Constructor instantiating fields defined on a grid spanned up by several coordinate axes pointed to by the
+		 * \a coordAxisPointers with constant values \a fieldValues, stored in the memory layout \a layout and allocated
+		 * according to the storage policy \a policy.
+		 */
+		MultiFieldGridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const FieldValues<FieldNumber>& fieldValues, FieldLayout layout = FieldLayout::Interleaved, const StoragePolicy& policy = DefaultStoragePolicy);
+		
+		/**
+		 * Constructor instantiating fields defined on a grid spanned up by several coordinate axes pointed to by the
+		 * \a coordAxisPointers with the values of all fields at each grid point set to the values returned by the MultiDimGrid::MultiFieldFunction
+		 * \a func at the coordinates of this grid point, stored in the memory layout \a layout and allocated according to
+		 * the storage policy \a policy.
+		 * 
+		 * The evaluations of \a func are distributed among OpenMP threads according to \a schedule, so \a func has
+		 * to be safe to call concurrently unless \a schedule is ParallelSchedule::Serial.
+		 */
+		MultiFieldGridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const MultiFieldFunction<Dim, FieldNumber>& func, FieldLayout layout = FieldLayout::Interleaved, ParallelSchedule schedule = ParallelSchedule::Serial, const StoragePolicy& policy = DefaultStoragePolicy);
+		
+		/**
+		 * Gives access to the value of the field with index \a i_field at the grid point \a gridPoint by returning a
+		 * \c reference to it.
+		 */
+		Value& value (const GridPoint<Dim>& gridPoint, std::size_t i_field);
+		
+		/**
+		 * Gives access to the value of the field with index \a i_field at the grid point \a gridPoint by returning a
+		 * \c const_reference to it.
+		 */
+		const Value& value (const GridPoint<Dim>& gridPoint, std::size_t i_field) const;
+		
+		/**
+		 * Gives access to the value of the field with index \a i_field at the grid point with index \a index by returning
+		 * a \c reference to it.
+		 */
+		Value& value_at_index (std::size_t index, std::size_t i_field);
+		
+		/**
+		 * Gives access to the value of the field with index \a i_field at the grid point with index \a index by returning
+		 * a \c const_reference to it.
+		 */
+		const Value& value_at_index (std::size_t index, std::size_t i_field) const;
+		
+		/**
+		 * Gives access to the value of the field with index \a i_field at the grid point with index \a index by returning
+		 * a \c reference to it.
+		 * 
+		 * In contrast to MultiFieldGridFunction::value_at_index, this method does not check if \a index and \a i_field
+		 * are within range. It is thus slightly faster, but unsafe!
+		 */
+		Value& value_at_index_unchecked (std::size_t index, std::size_t i_field);
+		
+		/**
+		 * Gives access to the value of the field with index \a i_field at the grid point with index \a index by returning
+		 * a \c const_reference to it.
+		 * 
+		 * In contrast to MultiFieldGridFunction::value_at_index, this method does not check if \a index and \a i_field
+		 * are within range. It is thus slightly faster, but unsafe!
+		 */
+		const Value& value_at_index_unchecked (std::size_t index, std::size_t i_field) const;
+		
+		/**
+		 * Returns the values of all fields at the coordinates \a coords, interpolated multi-linearly in the coordinate
+		 * spacings.
+		 */
+		FieldValues<FieldNumber> interpolate (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Returns the values of all fields at the coordinates \a coords, interpolated multi-linearly in the coordinate
+		 * spacings.
+		 * 
+		 * In contrast to MultiFieldGridFunction::interpolate, this method does not check if \a coords are within the range
+		 * of the grid. It is thus slightly faster, but unsafe!
+		 */
+		FieldValues<FieldNumber> interpolate_unchecked (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Overloads the parenthesis operator to return the values of all fields at the coordinates \a coords, interpolated
+		 * multi-linearly in the coordinate spacings.
+		 * 
+		 * This provides the same functionality as MultiFieldGridFunction::interpolate.
+		 */
+		FieldValues<FieldNumber> operator() (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Interpolates all fields at the \a number coordinates \a coords and writes the results to \a values, such that
+		 * values[i * FieldNumber + j] is the value of the field with index j at coords[i]. The coordinates are distributed
+		 * among OpenMP threads according to \a schedule.
+		 */
+		void interpolate_many (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Interpolates all fields at the \a number coordinates \a coords and writes the results to \a values, such that
+		 * values[i * FieldNumber + j] is the value of the field with index j at coords[i]. The coordinates are distributed
+		 * among OpenMP threads according to \a schedule.
+		 * 
+		 * In contrast to MultiFieldGridFunction::interpolate_many, this method does not check if \a coords are within the
+		 * range of the grid. It is thus slightly faster, but unsafe!
+		 */
+		void interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns the memory layout of the function values.
+		 */
+		FieldLayout field_layout () const;
+		
+		/**
+		 * Returns a GridFunction containing a copy of the values of the field with index \a i_field, defined on the same
+		 * coordinate axes, which are shared rather than copied. The values are allocated according to the storage policy
+		 * of this multi-field grid function.
+		 */
+		GridFunction<Dim, Value> field (std::size_t i_field) const;
+	
+	private:
+		using CoordinateGrid<Dim>::CornerNumber;
+		using CoordinateGrid<Dim>::CoordAxes;
+		using CoordinateGrid<Dim>::IndexStrides;
+		using CoordinateGrid<Dim>::CornerOffsets;
+		using CoordinateGrid<Dim>::GridPointNumber;
+		using CoordinateGrid<Dim>::locate_cell;
+		using CoordinateGrid<Dim>::check_axis_point;
+		using CoordinateGrid<Dim>::check_coordinates;
+		using CoordinateGrid<Dim>::check_index;
+		
+		/**
+		 * Memory layout of the function values.
+		 */
+		FieldLayout Layout;
+		
+		/**
+		 * Index difference between the values of the same field at neighbouring grid points in MultiFieldGridFunction::FunctionValues.
+		 * It is \a FieldNumber in the interleaved layout and 1 in the field-major layout.
+		 */
+		std::size_t PointStride;
+		
+		/**
+		 * Index difference between the values of neighbouring fields at the same grid point in MultiFieldGridFunction::FunctionValues.
+		 * It is 1 in the interleaved layout and the number of grid points in the field-major layout.
+		 */
+		std::size_t FieldStride;
+		
+		/**
+		 * Internal 1-dimensional storage of the values of all fields at each grid point.
+		 * 
+		 * The value of the field with index j at the grid point with index i, as defined in GridFunction::FunctionValues,
+		 * is stored at the buffer element with index (i * MultiFieldGridFunction::PointStride + j * MultiFieldGridFunction::FieldStride).
+		 */
+		FunctionValueBuffer<Value> FunctionValues;
+		
+		/**
+		 * Returns the index of the value of the field with index \a i_field at the grid point with index \a index in MultiFieldGridFunction::FunctionValues.
+		 */
+		std::size_t storage_index (std::size_t index, std::size_t i_field) const;
+		
+		/**
+		 * Checks if the field index \a i_field is out of range. If that is the case, an error message is written to the
+		 * standard output and the program is terminated. The error message contains \a location, which specifies in which
+		 * member the field range is checked.
+		 */
+		void check_field (std::size_t i_field, const char* location) const;
+	};
+}
+
+#include "MultiFieldGridFunction.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::MultiFieldGridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const FieldValues<FieldNumber>& fieldValues, const FieldLayout layout, const StoragePolicy& policy) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Layout(layout),
+	PointStride( (layout == FieldLayout::Interleaved) ? FieldNumber : 1 ),
+	FieldStride( (layout == FieldLayout::Interleaved) ? 1 : GridPointNumber ),
+	FunctionValues(GridPointNumber * FieldNumber, policy)	// the uninitialized function values are first written below
+{
+	static_assert(FieldNumber != 0, "MultiDimGrid::MultiFieldGridFunction Error: Number of fields is zero");
+	
+	for ( std::size_t index = 0; index < GridPointNumber; ++index )
+	{
+		for ( std::size_t i_field = 0; i_field < FieldNumber; ++i_field )
+		{
+			FunctionValues[storage_index(index, i_field)] = fieldValues[i_field];
+		}
+	}
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::MultiFieldGridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const MultiFieldFunction<Dim, FieldNumber>& func, const FieldLayout layout, const ParallelSchedule schedule, const StoragePolicy& policy) :
+	CoordinateGrid<Dim>(coordAxisPointers),
+	Layout(layout),
+	PointStride( (layout == FieldLayout::Interleaved) ? FieldNumber : 1 ),
+	FieldStride( (layout == FieldLayout::Interleaved) ? 1 : GridPointNumber ),
+	FunctionValues(GridPointNumber * FieldNumber, policy)	// the uninitialized function values are first written by the evaluations
+{
+	static_assert(FieldNumber != 0, "MultiDimGrid::MultiFieldGridFunction Error: Number of fields is zero");
+	
+	this->for_each_point([this, &func] (const GridPointVisit<Dim>& visit)	// evaluate 'func' once at the coordinates of every grid point, which yields the values of all fields there
+	{
+		const FieldValues<FieldNumber> fieldValues = func(visit.Coords);
+		
+		for ( std::size_t i_field = 0; i_field < FieldNumber; ++i_field )
+		{
+			FunctionValues[storage_index(visit.Index, i_field)] = fieldValues[i_field];
+		}
+	}, schedule);
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+Value& MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::value (const GridPoint<Dim>& gridPoint, const std::size_t i_field)
+{
+	std::size_t index = 0;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const std::size_t axisPoint = gridPoint[i_axis];
+		
+		check_axis_point(axisPoint, CoordAxes[i_axis].get(), "MultiFieldGridFunction::value");
+		
+		index += axisPoint * IndexStrides[i_axis];
+	}
+	
+	check_field(i_field, "value");
+	
+	return FunctionValues[storage_index(index, i_field)];
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+const Value& MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::value (const GridPoint<Dim>& gridPoint, const std::size_t i_field) const
+{
+	std::size_t index = 0;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const std::size_t axisPoint = gridPoint[i_axis];
+		
+		check_axis_point(axisPoint, CoordAxes[i_axis].get(), "MultiFieldGridFunction::value");
+		
+		index += axisPoint * IndexStrides[i_axis];
+	}
+	
+	check_field(i_field, "value");
+	
+	return FunctionValues[storage_index(index, i_field)];
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+Value& MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::value_at_index (const std::size_t index, const std::size_t i_field)
+{
+	check_index(index, "MultiFieldGridFunction::value_at_index");
+	check_field(i_field, "value_at_index");
+	
+	return FunctionValues[storage_index(index, i_field)];
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+const Value& MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::value_at_index (const std::size_t index, const std::size_t i_field) const
+{
+	check_index(index, "MultiFieldGridFunction::value_at_index");
+	check_field(i_field, "value_at_index");
+	
+	return FunctionValues[storage_index(index, i_field)];
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+Value& MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::value_at_index_unchecked (const std::size_t index, const std::size_t i_field)
+{
+	return FunctionValues[storage_index(index, i_field)];
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+const Value& MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::value_at_index_unchecked (const std::size_t index, const std::size_t i_field) const
+{
+	return FunctionValues[storage_index(index, i_field)];
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+MultiDimGrid::FieldValues<FieldNumber> MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::interpolate (const Coordinates<Dim>& coords) const
+{
+	check_coordinates(coords, "MultiFieldGridFunction::interpolate");
+	
+	return interpolate_unchecked(coords);
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+MultiDimGrid::FieldValues<FieldNumber> MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::interpolate_unchecked (const Coordinates<Dim>& coords) const
+{
+	DoubleArray<Dim> interpolationWeights;
+	
+	const std::size_t cellIndex = locate_cell(coords, interpolationWeights);	// the grid cell and the interpolation weights are determined only once for all fields
+	
+	std::array<double, CornerNumber * FieldNumber> cornerValues;	// values of all fields at the corners of the grid cell, stored corner by corner
+	
+	for ( std::size_t i_corner = 0; i_corner < CornerNumber; ++i_corner )
+	{
+		const Value* pointValues = &FunctionValues[(cellIndex + CornerOffsets[i_corner]) * PointStride];	// in the interleaved layout, the values of all fields at a corner are adjacent
+		
+		double* fieldCornerValues = &cornerValues[i_corner * FieldNumber];
+		
+		for ( std::size_t i_field = 0; i_field < FieldNumber; ++i_field )
+		{
+			fieldCornerValues[i_field] = pointValues[i_field * FieldStride];
+		}
+	}
+	
+	std::size_t remainingCornerNumber = CornerNumber;
+	
+	for ( std::size_t i_bit = 0; i_bit < Dim; ++i_bit )	// perform the 1-dimensional interpolations axis by axis, starting with the innermost one, by combining pairs of corners that only differ along that axis; each step halves the number of remaining corners
+	{
+		const double interpolationWeight = interpolationWeights[Dim - 1 - i_bit];
+		
+		remainingCornerNumber /= 2;
+		
+		for ( std::size_t i_corner = 0; i_corner < remainingCornerNumber; ++i_corner )
+		{
+			double* combinedValues = &cornerValues[i_corner * FieldNumber];
+			const double* lowerValues = &cornerValues[(2 * i_corner) * FieldNumber];
+			const double* higherValues = &cornerValues[(2 * i_corner + 1) * FieldNumber];
+			
+			for ( std::size_t i_field = 0; i_field < FieldNumber; ++i_field )	// all fields are combined with the same weight, so this innermost loop is vectorizable
+			{
+				combinedValues[i_field] = lowerValues[i_field] * (1.0 - interpolationWeight) + higherValues[i_field] * interpolationWeight;
+			}
+		}
+	}
+	
+	FieldValues<FieldNumber> fieldValues;
+	
+	for ( std::size_t i_field = 0; i_field < FieldNumber; ++i_field )
+	{
+		fieldValues[i_field] = cornerValues[i_field];
+	}
+	
+	return fieldValues;
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+MultiDimGrid::FieldValues<FieldNumber> MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::operator() (const Coordinates<Dim>& coords) const
+{
+	return interpolate(coords);
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+void MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::interpolate_many (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, values] (const std::size_t i_coords)
+	{
+		check_coordinates(coords[i_coords], "MultiFieldGridFunction::interpolate_many");
+		
+		const FieldValues<FieldNumber> fieldValues = interpolate_unchecked(coords[i_coords]);
+		
+		for ( std::size_t i_field = 0; i_field < FieldNumber; ++i_field )
+		{
+			values[i_coords * FieldNumber + i_field] = fieldValues[i_field];
+		}
+	});
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+void MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, values] (const std::size_t i_coords)
+	{
+		const FieldValues<FieldNumber> fieldValues = interpolate_unchecked(coords[i_coords]);
+		
+		for ( std::size_t i_field = 0; i_field < FieldNumber; ++i_field )
+		{
+			values[i_coords * FieldNumber + i_field] = fieldValues[i_field];
+		}
+	});
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+MultiDimGrid::FieldLayout MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::field_layout () const
+{
+	return Layout;
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+MultiDimGrid::GridFunction<Dim, Value> MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::field (const std::size_t i_field) const
+{
+	check_field(i_field, "field");
+	
+	FunctionValueBuffer<Value> fieldValues(GridPointNumber, FunctionValues.storage_policy());	// the uninitialized values are first written below
+	
+	for ( std::size_t index = 0; index < GridPointNumber; ++index )
+	{
+		fieldValues[index] = FunctionValues[storage_index(index, i_field)];
+	}
+	
+	return GridFunction<Dim, Value>(CoordAxes, std::move(fieldValues));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+std::size_t MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::storage_index (const std::size_t index, const std::size_t i_field) const
+{
+	return index * PointStride + i_field * FieldStride;
+}
+
+template <std::size_t Dim, std::size_t FieldNumber, class Value>
+void MultiDimGrid::MultiFieldGridFunction<Dim, FieldNumber, Value>::check_field (const std::size_t i_field, const char* location) const
+{
+	if ( i_field >= FieldNumber )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::MultiFieldGridFunction::" + std::string(location) + " Error: Field not within range" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef MULTIDIMGRID_PARALLELIZATION_H
+#define MULTIDIMGRID_PARALLELIZATION_H
+
+#include <cstddef>
+
+namespace MultiDimGrid
+{
+	/**
+	 * Schedules according to which work that is independent for every grid point, like the evaluation of a function
+	 * at all grid points during the construction of a GridFunction, can be distributed among OpenMP threads.
+	 * 
+	 * ParallelSchedule::Serial performs the work on the calling thread only. The other values correspond to the OpenMP
+	 * loop schedules of the same name, i.e. ParallelSchedule::Static assigns equally sized contiguous index ranges to the
+	 * threads, while ParallelSchedule::Dynamic and ParallelSchedule::Guided hand out index ranges on demand, which is
+	 * preferable if the cost of the work varies strongly between grid points.
+	 * 
+	 * Each grid point is always processed exactly once, so the results do not depend on the chosen schedule.
+	 */
+	enum class ParallelSchedule
+	{
+		Serial,
+		Static,
+		Dynamic,
+		Guided
+	};
+	
+	/**
+	 * Calls \a body once for every value of the index \a index in the range [0, \a number), distributing these calls
+	 * among OpenMP threads according to \a schedule.
+	 * 
+	 * \a body has to be callable as \a body(index) and must be safe to call concurrently for different index values
+	 * unless \a schedule is ParallelSchedule::Serial.
+	 */
+	template <class Body>
+	void parallel_for (std::size_t number, ParallelSchedule schedule, const Body& body);
+}
+
+#include "Parallelization.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include <cstddef>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+template <class Body>
+void MultiDimGrid::parallel_for (const std::size_t number, const ParallelSchedule schedule, const Body& body)
+{
+	switch ( schedule )	// OpenMP only accepts the loop schedule as part of the pragma, hence there is a separate loop for each one
+	{
+		case ParallelSchedule::Static:
+			#pragma omp parallel for schedule(static)
+			for ( std::size_t index = 0; index < number; ++index )
+			{
+				body(index);
+			}
+			break;
+		
+		case ParallelSchedule::Dynamic:
+			#pragma omp parallel for schedule(dynamic)
+			for ( std::size_t index = 0; index < number; ++index )
+			{
+				body(index);
+			}
+			break;
+		
+		case ParallelSchedule::Guided:
+			#pragma omp parallel for schedule(guided)
+			for ( std::size_t index = 0; index < number; ++index )
+			{
+				body(index);
+			}
+			break;
+		
+		default:
+			for ( std::size_t index = 0; index < number; ++index )
+			{
+				body(index);
+			}
+	}
+}
\ No newline at end of file
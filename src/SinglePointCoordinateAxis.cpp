@@ -22,19 +22,19 @@ double MultiDimGrid::SinglePointCoordinateAxis::integration_weight_unchecked (co
 	return 0.0;	// the integral over a single point vanishes
 }
 
-double MultiDimGrid::SinglePointCoordinateAxis::interpolation_weight_unchecked (const double coord) const
+MultiDimGrid::AxisLocation MultiDimGrid::SinglePointCoordinateAxis::locate_unchecked (const double coord) const
 {
-	return 0.0;	// the only valid 'coord' is the single axis point itself
+	return {0, 0, 0.0};	// the only valid 'coord' is the single axis point itself
 }
 
-std::size_t MultiDimGrid::SinglePointCoordinateAxis::nearest_lower_axis_point_unchecked (const double coord) const
+double MultiDimGrid::SinglePointCoordinateAxis::interpolation_weight_derivative_unchecked (const double coord) const
 {
-	return 0;	// the only point on the axis
+	return 0.0;	// there is no interpolation along a single point
 }
 
-std::size_t MultiDimGrid::SinglePointCoordinateAxis::nearest_higher_axis_point_unchecked (const double coord) const
+MultiDimGrid::AxisDescription MultiDimGrid::SinglePointCoordinateAxis::description () const
 {
-	return 0;	// the only point on the axis
+	return {AxisType::SinglePoint, Coordinate, Coordinate, 0.0, 0, 0};
 }
 
 MultiDimGrid::SinglePointCoordinateAxis* MultiDimGrid::SinglePointCoordinateAxis::clone () const
@@ -25,11 +25,11 @@ namespace MultiDimGrid
 		
 		double integration_weight_unchecked (std::size_t axisPoint) const;
 		
-		double interpolation_weight_unchecked (double coord) const;
+		AxisLocation locate_unchecked (double coord) const;
 		
-		std::size_t nearest_lower_axis_point_unchecked (double coord) const;
+		double interpolation_weight_derivative_unchecked (double coord) const;
 		
-		std::size_t nearest_higher_axis_point_unchecked (double coord) const;
+		AxisDescription description () const;
 		
 		SinglePointCoordinateAxis* clone () const;
 	
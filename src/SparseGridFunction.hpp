@@ -0,0 +1,167 @@
+#ifndef MULTIDIMGRID_SPARSE_GRID_FUNCTION_H
+#define MULTIDIMGRID_SPARSE_GRID_FUNCTION_H
+
+#include "CoordinateAxis.hpp"
+#include "CoordinateGrid.hpp"
+#include "GridFunction.hpp"
+#include "Parallelization.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace MultiDimGrid
+{
+	/**
+	 * \brief Class providing a discrete function defined on a multi-dimensional sparse grid.
+	 * 
+	 * The sparse grid is built with the combination technique out of a set of coarse GridFunction instances, called components,
+	 * whose coordinate axes are refined versions of the coordinate axes the sparse grid is constructed with. The axes
+	 * of each component are refined by the factors (2^l_0, ... , 2^l_(n-1)), and its level vector (l_0, ... , l_(n-1))
+	 * satisfies l_0 + ... + l_(n-1) = L - q with the level L of the sparse grid and q = 0, ... , n-1. The interpolation
+	 * is the sum of the multi-linear interpolations of all components, weighted with the combination coefficients
+	 * (-1)^q * binomial(n-1, q). Single-point axes are never refined and do not count towards the number of axes n.
+	 * 
+	 * The finest resolution along each axis is thus the one of the full grid refined by 2^L along every axis, while the
+	 * total number of function values, and hence of evaluations of the discretized function, only grows as
+	 * O(N * log(N)^(n-1)) with the number of axis points N of this finest resolution, instead of O(N^n). For sufficiently
+	 * smooth functions, the interpolation error only deteriorates by a factor of order log(N)^(n-1) compared to the full
+	 * grid.
+	 * 
+	 * As for GridFunction, the function values are stored as \a Value, while all computations are carried out in \c double
+	 * precision.
+	 */
+	template <std::size_t Dim, class Value = double>
+	class SparseGridFunction
+	{
+	public:
+		/**
+		 * Constructor instantiating a discrete function defined on the sparse grid of level \a level spanned up by the
+		 * coordinate axes pointed to by the \a coordAxisPointers, which form the coarsest grid that enters the combination,
+		 * with the function value of each grid point set to the value of the MultiDimGrid::Function \a func at the
+		 * coordinates of this grid point.
+		 * 
+		 * The evaluations of \a func within each component are distributed among OpenMP threads according to \a schedule,
+		 * so \a func has to be safe to call concurrently unless \a schedule is ParallelSchedule::Serial.
+		 */
+		SparseGridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, std::size_t level, const Function<Dim>& func, ParallelSchedule schedule = ParallelSchedule::Serial);
+		
+		/**
+		 * Returns the interpolated function value of the discrete function at the coordinates \a coords.
+		 */
+		double interpolate (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Returns the interpolated function value of the discrete function at the coordinates \a coords.
+		 * 
+		 * In contrast to SparseGridFunction::interpolate, this method does not check if \a coords is within the range of
+		 * the grid. It is thus slightly faster, but unsafe!
+		 */
+		double interpolate_unchecked (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Overloads the paranthesis operator to return the interpolated function value of the discrete function at the
+		 * coordinates \a coords.
+		 * 
+		 * This provides the same functionality as SparseGridFunction::interpolate.
+		 */
+		double operator() (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Computes the interpolated function values of the discrete function at the \a number coordinates stored in the
+		 * array \a coords and writes them to the array \a values, which has to be of the same length.
+		 * 
+		 * The components are interpolated one after another using GridFunction::interpolate_many, with the batches of
+		 * coordinates distributed among OpenMP threads according to \a schedule.
+		 */
+		void interpolate_many (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Computes the interpolated function values of the discrete function at the \a number coordinates stored in the
+		 * array \a coords and writes them to the array \a values, which has to be of the same length.
+		 * 
+		 * In contrast to SparseGridFunction::interpolate_many, this method does not check if \a coords are within the range
+		 * of the grid. It is thus slightly faster, but unsafe!
+		 */
+		void interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns the integral of the discrete function over the whole grid, i.e. the combination of the integrals of
+		 * all components computed with GridFunction::integrate.
+		 */
+		double integrate (ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns the level of the sparse grid.
+		 */
+		std::size_t level () const;
+		
+		/**
+		 * Returns the number of components.
+		 */
+		std::size_t component_number () const;
+		
+		/**
+		 * Returns a reference to the component with index \a i_component.
+		 */
+		const GridFunction<Dim, Value>& component (std::size_t i_component) const;
+		
+		/**
+		 * Returns the combination coefficient of the component with index \a i_component.
+		 */
+		double combination_coefficient (std::size_t i_component) const;
+		
+		/**
+		 * Returns the total number of function values stored in all components.
+		 */
+		std::size_t point_number () const;
+	
+	protected:
+	
+	private:
+		/**
+		 * Level of the sparse grid.
+		 */
+		std::size_t Level;
+		
+		/**
+		 * Grid functions whose weighted sum forms the sparse grid function.
+		 */
+		std::vector<GridFunction<Dim, Value>> Components;
+		
+		/**
+		 * Weights of the components in the combination.
+		 */
+		std::vector<double> CombinationCoefficients;
+		
+		/**
+		 * Appends to \a levelVectors all level vectors that coincide with \a levelVector along the axes with indices smaller
+		 * than \a i_axis and whose remaining entries sum up to \a remainingLevelSum. The entries along the axes for which
+		 * \a isRefinable is \c false are always zero.
+		 */
+		static void append_level_vectors (const std::array<bool, Dim>& isRefinable, std::size_t i_axis, std::size_t remainingLevelSum, IntegerArray<Dim>& levelVector, std::vector<IntegerArray<Dim>>& levelVectors);
+		
+		/**
+		 * Returns the binomial coefficient of \a n and \a k.
+		 */
+		static double binomial_coefficient (std::size_t n, std::size_t k);
+		
+		/**
+		 * Checks if any of the coordinates \a coords is out of the range of its coordinate axis. If that is the case, an
+		 * error message is written to the standard output and the program is terminated. The error message contains \a location,
+		 * which specifies in which member the coordinate range is checked.
+		 */
+		void check_coordinates (const Coordinates<Dim>& coords, const char* location) const;
+		
+		/**
+		 * Checks if the component index \a i_component is out of range. If that is the case, an error message is written
+		 * to the standard output and the program is terminated. The error message contains \a location, which specifies
+		 * in which member the component range is checked.
+		 */
+		void check_component (std::size_t i_component, const char* location) const;
+	};
+}
+
+#include "SparseGridFunction.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
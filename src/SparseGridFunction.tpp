@@ -0,0 +1,267 @@
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+template <std::size_t Dim, class Value>
+MultiDimGrid::SparseGridFunction<Dim, Value>::SparseGridFunction (const CoordinateAxisPointers<Dim>& coordAxisPointers, const std::size_t level, const Function<Dim>& func, const ParallelSchedule schedule) :
+	Level(level),
+	Components(),
+	CombinationCoefficients()
+{
+	std::array<bool, Dim> isRefinable;
+	std::size_t refinableAxisNumber = 0;
+	
+	std::array<std::vector<std::unique_ptr<CoordinateAxis>>, Dim> refinedCoordAxes;	// the coordinate axes of all components, refined by the factors 2^0, ... , 2^'level'
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		isRefinable[i_axis] = ( coordAxisPointers[i_axis]->point_number() > 1 );
+		
+		if ( isRefinable[i_axis] )
+		{
+			++refinableAxisNumber;
+		}
+		
+		for ( std::size_t i_level = 0; i_level <= Level; ++i_level )
+		{
+			refinedCoordAxes[i_axis].emplace_back( create_refined_coordinate_axis(*coordAxisPointers[i_axis], std::size_t(1) << i_level) );
+		}
+	}
+	
+	const std::size_t combinationDepth = (refinableAxisNumber > 0) ? refinableAxisNumber : 1;	// a grid without refinable axes consists of a single component
+	
+	std::vector<IntegerArray<Dim>> levelVectors;	// the level vectors of all components, collected first so that the components can be built in place
+	std::vector<double> componentCoefficients;
+	
+	for ( std::size_t q = 0; (q < combinationDepth) && (q <= Level); ++q )
+	{
+		const double combinationCoefficient = ( (q % 2 == 0) ? 1.0 : -1.0 ) * binomial_coefficient(combinationDepth - 1, q);
+		
+		IntegerArray<Dim> levelVector;
+		
+		levelVector.fill(0);
+		
+		append_level_vectors(isRefinable, 0, Level - q, levelVector, levelVectors);
+		
+		componentCoefficients.resize(levelVectors.size(), combinationCoefficient);
+	}
+	
+	Components.reserve(levelVectors.size());
+	CombinationCoefficients.reserve(levelVectors.size());
+	
+	for ( std::size_t i_component = 0; i_component < levelVectors.size(); ++i_component )
+	{
+		CoordinateAxisPointers<Dim> componentAxisPointers;
+		
+		for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+		{
+			componentAxisPointers[i_axis] = refinedCoordAxes[i_axis][levelVectors[i_component][i_axis]].get();
+		}
+		
+		Components.emplace_back(componentAxisPointers, func, schedule);
+		CombinationCoefficients.push_back(componentCoefficients[i_component]);
+	}
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::SparseGridFunction<Dim, Value>::interpolate (const Coordinates<Dim>& coords) const
+{
+	check_coordinates(coords, "interpolate");
+	
+	return interpolate_unchecked(coords);
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::SparseGridFunction<Dim, Value>::interpolate_unchecked (const Coordinates<Dim>& coords) const
+{
+	double value = 0.0;
+	
+	for ( std::size_t i_component = 0; i_component < Components.size(); ++i_component )
+	{
+		value += CombinationCoefficients[i_component] * Components[i_component].interpolate_unchecked(coords);
+	}
+	
+	return value;
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::SparseGridFunction<Dim, Value>::operator() (const Coordinates<Dim>& coords) const
+{
+	return interpolate(coords);
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::SparseGridFunction<Dim, Value>::interpolate_many (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	for ( std::size_t i_coords = 0; i_coords < number; ++i_coords )
+	{
+		check_coordinates(coords[i_coords], "interpolate_many");
+	}
+	
+	interpolate_many_unchecked(coords, values, number, schedule);
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::SparseGridFunction<Dim, Value>::interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	std::vector<double> componentValues(number);
+	
+	for ( std::size_t i_coords = 0; i_coords < number; ++i_coords )
+	{
+		values[i_coords] = 0.0;
+	}
+	
+	for ( std::size_t i_component = 0; i_component < Components.size(); ++i_component )	// each component is interpolated at all coordinates at once, which makes use of its batched interpolation
+	{
+		const double combinationCoefficient = CombinationCoefficients[i_component];
+		
+		Components[i_component].interpolate_many_unchecked(coords, componentValues.data(), number, schedule);
+		
+		for ( std::size_t i_coords = 0; i_coords < number; ++i_coords )
+		{
+			values[i_coords] += combinationCoefficient * componentValues[i_coords];
+		}
+	}
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::SparseGridFunction<Dim, Value>::integrate (const ParallelSchedule schedule) const
+{
+	double integral = 0.0;
+	
+	for ( std::size_t i_component = 0; i_component < Components.size(); ++i_component )
+	{
+		integral += CombinationCoefficients[i_component] * Components[i_component].integrate(schedule);
+	}
+	
+	return integral;
+}
+
+template <std::size_t Dim, class Value>
+std::size_t MultiDimGrid::SparseGridFunction<Dim, Value>::level () const
+{
+	return Level;
+}
+
+template <std::size_t Dim, class Value>
+std::size_t MultiDimGrid::SparseGridFunction<Dim, Value>::component_number () const
+{
+	return Components.size();
+}
+
+template <std::size_t Dim, class Value>
+const MultiDimGrid::GridFunction<Dim, Value>& MultiDimGrid::SparseGridFunction<Dim, Value>::component (const std::size_t i_component) const
+{
+	check_component(i_component, "component");
+	
+	return Components[i_component];
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::SparseGridFunction<Dim, Value>::combination_coefficient (const std::size_t i_component) const
+{
+	check_component(i_component, "combination_coefficient");
+	
+	return CombinationCoefficients[i_component];
+}
+
+template <std::size_t Dim, class Value>
+std::size_t MultiDimGrid::SparseGridFunction<Dim, Value>::point_number () const
+{
+	std::size_t pointNumber = 0;
+	
+	for ( const GridFunction<Dim, Value>& component : Components )
+	{
+		pointNumber += component.point_number();
+	}
+	
+	return pointNumber;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::SparseGridFunction<Dim, Value>::append_level_vectors (const std::array<bool, Dim>& isRefinable, const std::size_t i_axis, const std::size_t remainingLevelSum, IntegerArray<Dim>& levelVector, std::vector<IntegerArray<Dim>>& levelVectors)
+{
+	if ( i_axis == Dim )
+	{
+		if ( remainingLevelSum == 0 )	// only complete level vectors are kept
+		{
+			levelVectors.push_back(levelVector);
+		}
+		
+		return;
+	}
+	
+	if ( !isRefinable[i_axis] )
+	{
+		levelVector[i_axis] = 0;
+		
+		append_level_vectors(isRefinable, i_axis + 1, remainingLevelSum, levelVector, levelVectors);
+		
+		return;
+	}
+	
+	for ( std::size_t i_level = 0; i_level <= remainingLevelSum; ++i_level )
+	{
+		levelVector[i_axis] = i_level;
+		
+		append_level_vectors(isRefinable, i_axis + 1, remainingLevelSum - i_level, levelVector, levelVectors);
+	}
+}
+
+template <std::size_t Dim, class Value>
+double MultiDimGrid::SparseGridFunction<Dim, Value>::binomial_coefficient (const std::size_t n, const std::size_t k)
+{
+	double coefficient = 1.0;
+	
+	for ( std::size_t i = 1; i <= k; ++i )
+	{
+		coefficient = coefficient * (n - k + i) / i;
+	}
+	
+	return coefficient;
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::SparseGridFunction<Dim, Value>::check_coordinates (const Coordinates<Dim>& coords, const char* location) const
+{
+	const GridFunction<Dim, Value>& coarsestComponent = Components.back();	// all components cover the same range
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		const CoordinateAxis& coordAxis = coarsestComponent.coordinate_axis(i_axis);
+		
+		if ( (coords[i_axis] < coordAxis.lower_coordinate_limit()) || (coords[i_axis] > coordAxis.upper_coordinate_limit()) )
+		{
+			std::cout << std::endl
+					  << " MultiDimGrid::SparseGridFunction::" + std::string(location) + " Coordinates not within range of grid" << std::endl
+					  << std::endl;
+			
+			exit(EXIT_FAILURE);
+		}
+	}
+}
+
+template <std::size_t Dim, class Value>
+void MultiDimGrid::SparseGridFunction<Dim, Value>::check_component (const std::size_t i_component, const char* location) const
+{
+	if ( i_component >= Components.size() )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::SparseGridFunction::" + std::string(location) + " Error: Component not within range" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+}
\ No newline at end of file
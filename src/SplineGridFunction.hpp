@@ -0,0 +1,166 @@
+#ifndef MULTIDIMGRID_SPLINE_GRID_FUNCTION_H
+#define MULTIDIMGRID_SPLINE_GRID_FUNCTION_H
+
+#include "CoordinateGrid.hpp"
+#include "GridFunction.hpp"
+#include "Parallelization.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace MultiDimGrid
+{
+	/**
+	 * Types of the piecewise cubic interpolation performed by a SplineGridFunction.
+	 * 
+	 * SplineType::NaturalCubic is the interpolating cubic spline with vanishing second derivatives at the limits of
+	 * each axis. It is twice continuously differentiable and fourth order accurate in the interior of the grid, but only
+	 * second order accurate close to the limits, unless the second derivatives of the interpolated function vanish there.
+	 * SplineType::CatmullRom is the cubic Hermite interpolation with derivatives estimated from the neighbouring function
+	 * values, which are extrapolated cubically beyond the limits. It is only once continuously differentiable and third
+	 * order accurate, but local, so it overshoots less near steep features.
+	 */
+	enum class SplineType
+	{
+		NaturalCubic,
+		CatmullRom
+	};
+	
+	/**
+	 * \brief Class providing a tensor-product cubic interpolation of the function values of a GridFunction.
+	 * 
+	 * As for the multi-linear interpolation of GridFunction, the interpolation is performed in the coordinate spacings,
+	 * i.e. in the axis point index of each coordinate axis, so a LogarithmicCoordinateAxis is interpolated cubically in
+	 * the logarithm of the coordinate. Each interpolation combines the 4^Dim grid points surrounding the coordinates,
+	 * which gives a higher order accurate interpolation of smooth functions and thus allows for much coarser grids than
+	 * the multi-linear interpolation at the same accuracy.
+	 * 
+	 * On construction, the function values are converted separably, one axis after the other, into coefficients of the
+	 * chosen SplineType, which are stored together with one additional layer of extrapolated coefficients below and two
+	 * above the limits of each axis. An interpolation then only needs to compute four weights per axis and sum up the
+	 * coefficients of the surrounding grid points, independently of the position of the grid cell.
+	 * 
+	 * The coefficients are a snapshot of the function values at construction and are not affected by later modifications
+	 * of the GridFunction.
+	 */
+	template <std::size_t Dim>
+	class SplineGridFunction : public CoordinateGrid<Dim>
+	{
+	public:
+		/**
+		 * Constructor computing the coefficients of a cubic interpolation of type \a splineType of the function values of
+		 * \a gridFunction, which is defined on the same coordinate axes. The computation is distributed among OpenMP threads
+		 * according to \a schedule.
+		 */
+		template <class Value>
+		SplineGridFunction (const GridFunction<Dim, Value>& gridFunction, SplineType splineType = SplineType::NaturalCubic, ParallelSchedule schedule = ParallelSchedule::Serial);
+		
+		/**
+		 * Returns the interpolated function value at the coordinates \a coords.
+		 */
+		double interpolate (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Returns the interpolated function value at the coordinates \a coords.
+		 * 
+		 * In contrast to SplineGridFunction::interpolate, this method does not check if \a coords is within the range of
+		 * the grid. It is thus slightly faster, but unsafe!
+		 */
+		double interpolate_unchecked (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Overloads the paranthesis operator to return the interpolated function value at the coordinates \a coords.
+		 * 
+		 * This provides the same functionality as SplineGridFunction::interpolate.
+		 */
+		double operator() (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Computes the interpolated function values at the \a number coordinates stored in the array \a coords and writes
+		 * them to the array \a values, which has to be of the same length. The interpolations are distributed among OpenMP
+		 * threads according to \a schedule.
+		 */
+		void interpolate_many (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Computes the interpolated function values at the \a number coordinates stored in the array \a coords and writes
+		 * them to the array \a values, which has to be of the same length.
+		 * 
+		 * In contrast to SplineGridFunction::interpolate_many, this method does not check if \a coords are within the range
+		 * of the grid. It is thus slightly faster, but unsafe!
+		 */
+		void interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns the type of the cubic interpolation.
+		 */
+		SplineType spline_type () const;
+	
+	protected:
+	
+	private:
+		using CoordinateGrid<Dim>::CoordAxes;
+		using CoordinateGrid<Dim>::IndexStrides;
+		using CoordinateGrid<Dim>::GridPointNumber;
+		using CoordinateGrid<Dim>::locate_cell_axis_point;
+		using CoordinateGrid<Dim>::check_coordinates;
+		
+		/**
+		 * Number of grid points along each axis that contribute to an interpolation.
+		 */
+		static constexpr std::size_t StencilWidth = 4;
+		
+		/**
+		 * Number of grid points that contribute to an interpolation.
+		 */
+		static constexpr std::size_t StencilPointNumber = std::size_t(1) << (2 * Dim);
+		
+		/**
+		 * Type of the cubic interpolation.
+		 */
+		SplineType Type;
+		
+		/**
+		 * Numbers of stored coefficients along each coordinate axis, i.e. the number of axis points plus the three
+		 * extrapolated ones.
+		 */
+		IntegerArray<Dim> PaddedPointNumbers;
+		
+		/**
+		 * Index differences between neighbouring coefficients along each coordinate axis, analogous to CoordinateGrid::IndexStrides.
+		 */
+		IntegerArray<Dim> PaddedIndexStrides;
+		
+		/**
+		 * Index differences between the grid points contributing to an interpolation and the lowest of them.
+		 * 
+		 * The grid points are enumerated such that the bits (2*j+1, 2*j) of the point number give its position along the
+		 * axis with index (Dim-1-j), in analogy to CoordinateGrid::CornerOffsets.
+		 */
+		IntegerArray<StencilPointNumber> StencilOffsets;
+		
+		/**
+		 * Interpolation coefficients, stored in the nested fashion described in GridFunction::FunctionValues with the
+		 * numbers of points along each axis given by SplineGridFunction::PaddedPointNumbers. The coefficient corresponding
+		 * to the grid point (i_0, ... , i_(n-1)) is stored at the position (i_0 + 1, ... , i_(n-1) + 1).
+		 */
+		std::vector<double> Coefficients;
+		
+		/**
+		 * Computes the coefficients along the axis with index \a i_axis for all lines of coefficients parallel to it,
+		 * distributing them among OpenMP threads according to \a schedule. The coefficients along all axes with smaller
+		 * indices have to be computed beforehand.
+		 */
+		void compute_axis_coefficients (std::size_t i_axis, ParallelSchedule schedule);
+		
+		/**
+		 * Writes the four interpolation weights of the SplineType \a splineType corresponding to the interpolation weight
+		 * \a interpolationWeight within a grid cell to \a stencilWeights.
+		 */
+		static void compute_stencil_weights (SplineType splineType, double interpolationWeight, double* stencilWeights);
+	};
+}
+
+#include "SplineGridFunction.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
@@ -0,0 +1,252 @@
+#include <cstddef>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+template <std::size_t Dim>
+template <class Value>
+MultiDimGrid::SplineGridFunction<Dim>::SplineGridFunction (const GridFunction<Dim, Value>& gridFunction, const SplineType splineType, const ParallelSchedule schedule) :
+	CoordinateGrid<Dim>(gridFunction.shared_coordinate_axes()),
+	Type(splineType),
+	PaddedPointNumbers(),
+	PaddedIndexStrides(),
+	StencilOffsets(),
+	Coefficients()
+{
+	std::size_t paddedPointNumber = 1;
+	
+	for ( std::size_t i_axis = Dim; i_axis-- > 0; )
+	{
+		PaddedPointNumbers[i_axis] = CoordAxes[i_axis]->point_number() + StencilWidth - 1;	// one extrapolated point below the lower and two above the upper limit of the axis
+		
+		PaddedIndexStrides[i_axis] = paddedPointNumber;
+		
+		paddedPointNumber *= PaddedPointNumbers[i_axis];
+	}
+	
+	for ( std::size_t i_stencilPoint = 0; i_stencilPoint < StencilPointNumber; ++i_stencilPoint )
+	{
+		std::size_t stencilOffset = 0;
+		
+		for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+		{
+			const std::size_t axisOffset = (i_stencilPoint >> (2 * (Dim - 1 - i_axis))) & (StencilWidth - 1);
+			
+			stencilOffset += axisOffset * PaddedIndexStrides[i_axis];
+		}
+		
+		StencilOffsets[i_stencilPoint] = stencilOffset;
+	}
+	
+	Coefficients.resize(paddedPointNumber);
+	
+	parallel_for(GridPointNumber, schedule, [this, &gridFunction] (const std::size_t index)	// copy the function values to the interior of the padded coefficient array
+	{
+		std::size_t paddedIndex = 0;
+		std::size_t remainingIndex = index;
+		
+		for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+		{
+			paddedIndex += (remainingIndex / IndexStrides[i_axis] + 1) * PaddedIndexStrides[i_axis];
+			
+			remainingIndex %= IndexStrides[i_axis];
+		}
+		
+		Coefficients[paddedIndex] = gridFunction.value_at_index_unchecked(index);
+	});
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )	// the coefficients of a tensor-product interpolation follow by treating one axis after the other
+	{
+		compute_axis_coefficients(i_axis, schedule);
+	}
+}
+
+template <std::size_t Dim>
+double MultiDimGrid::SplineGridFunction<Dim>::interpolate (const Coordinates<Dim>& coords) const
+{
+	check_coordinates(coords, "SplineGridFunction::interpolate");
+	
+	return interpolate_unchecked(coords);
+}
+
+template <std::size_t Dim>
+double MultiDimGrid::SplineGridFunction<Dim>::interpolate_unchecked (const Coordinates<Dim>& coords) const
+{
+	double stencilWeights[Dim][StencilWidth];
+	
+	std::size_t stencilIndex = 0;
+	
+	for ( std::size_t i_axis = 0; i_axis < Dim; ++i_axis )
+	{
+		double interpolationWeight;
+		
+		const std::size_t cellAxisPoint = locate_cell_axis_point(i_axis, coords[i_axis], interpolationWeight);
+		
+		stencilIndex += cellAxisPoint * PaddedIndexStrides[i_axis];	// due to the padding, the lowest contributing point, one below the cell, is at the position of the lower axis point of the cell
+		
+		compute_stencil_weights(Type, interpolationWeight, stencilWeights[i_axis]);
+	}
+	
+	double stencilValues[StencilPointNumber];
+	
+	for ( std::size_t i_stencilPoint = 0; i_stencilPoint < StencilPointNumber; ++i_stencilPoint )
+	{
+		stencilValues[i_stencilPoint] = Coefficients[stencilIndex + StencilOffsets[i_stencilPoint]];
+	}
+	
+	std::size_t remainingPointNumber = StencilPointNumber;
+	
+	for ( std::size_t i_axis = Dim; i_axis-- > 0; )	// perform the 1-dimensional interpolations axis by axis, starting with the innermost one, by combining groups of four points that only differ along that axis
+	{
+		const double* axisWeights = stencilWeights[i_axis];
+		
+		remainingPointNumber /= StencilWidth;
+		
+		for ( std::size_t i_point = 0; i_point < remainingPointNumber; ++i_point )
+		{
+			const double* groupValues = &stencilValues[StencilWidth * i_point];
+			
+			stencilValues[i_point] = axisWeights[0] * groupValues[0] + axisWeights[1] * groupValues[1] + axisWeights[2] * groupValues[2] + axisWeights[3] * groupValues[3];
+		}
+	}
+	
+	return stencilValues[0];
+}
+
+template <std::size_t Dim>
+double MultiDimGrid::SplineGridFunction<Dim>::operator() (const Coordinates<Dim>& coords) const
+{
+	return interpolate(coords);
+}
+
+template <std::size_t Dim>
+void MultiDimGrid::SplineGridFunction<Dim>::interpolate_many (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, values] (const std::size_t i_coords)
+	{
+		values[i_coords] = interpolate(coords[i_coords]);
+	});
+}
+
+template <std::size_t Dim>
+void MultiDimGrid::SplineGridFunction<Dim>::interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, values] (const std::size_t i_coords)
+	{
+		values[i_coords] = interpolate_unchecked(coords[i_coords]);
+	});
+}
+
+template <std::size_t Dim>
+MultiDimGrid::SplineType MultiDimGrid::SplineGridFunction<Dim>::spline_type () const
+{
+	return Type;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <std::size_t Dim>
+void MultiDimGrid::SplineGridFunction<Dim>::compute_axis_coefficients (const std::size_t i_axis, const ParallelSchedule schedule)
+{
+	const std::size_t axisPointNumber = CoordAxes[i_axis]->point_number();
+	const std::size_t paddedAxisPointNumber = PaddedPointNumbers[i_axis];
+	const std::size_t stride = PaddedIndexStrides[i_axis];
+	const std::size_t lineNumber = Coefficients.size() / paddedAxisPointNumber;
+	
+	std::vector<double> eliminationFactors(axisPointNumber, 0.0);	// the natural spline coefficients of the inner axis points solve the same tridiagonal system for every line, so the factors of its forward elimination are computed only once
+	
+	if ( (Type == SplineType::NaturalCubic) && (axisPointNumber > 2) )
+	{
+		eliminationFactors[1] = 1.0 / 4.0;
+		
+		for ( std::size_t i_axisPoint = 2; i_axisPoint < axisPointNumber - 1; ++i_axisPoint )
+		{
+			eliminationFactors[i_axisPoint] = 1.0 / (4.0 - eliminationFactors[i_axisPoint - 1]);
+		}
+	}
+	
+	parallel_for(lineNumber, schedule, [&] (const std::size_t i_line)
+	{
+		const std::size_t outerIndex = i_line / stride;	// all other axes, including the padding of those already treated, enumerate the lines
+		const std::size_t innerIndex = i_line % stride;
+		
+		double* line = &Coefficients[outerIndex * paddedAxisPointNumber * stride + innerIndex];
+		
+		auto point = [line, stride] (const std::size_t i_paddedPoint) -> double& { return line[i_paddedPoint * stride]; };
+		
+		if ( (Type == SplineType::NaturalCubic) && (axisPointNumber > 2) )	// the B-spline coefficients c_i of the natural spline satisfy c_(i-1) + 4 c_i + c_(i+1) = 6 f_i at the inner axis points, while the vanishing second derivatives at the limits fix c_i = f_i there
+		{
+			const std::size_t lastAxisPoint = axisPointNumber - 1;
+			
+			for ( std::size_t i_axisPoint = 1; i_axisPoint < lastAxisPoint; ++i_axisPoint )	// forward elimination, overwriting the function values of the inner axis points
+			{
+				double rightHandSide = 6.0 * point(i_axisPoint + 1);
+				
+				rightHandSide -= (i_axisPoint == 1) ? point(1) : point(i_axisPoint);
+				
+				if ( i_axisPoint == lastAxisPoint - 1 )
+				{
+					rightHandSide -= point(lastAxisPoint + 1);
+				}
+				
+				point(i_axisPoint + 1) = rightHandSide * eliminationFactors[i_axisPoint];
+			}
+			
+			for ( std::size_t i_axisPoint = lastAxisPoint - 1; i_axisPoint-- > 1; )	// back substitution
+			{
+				point(i_axisPoint + 1) -= eliminationFactors[i_axisPoint] * point(i_axisPoint + 2);
+			}
+		}
+		
+		if ( axisPointNumber == 1 )	// along a single-point axis the function is constant
+		{
+			point(0) = point(1);
+			point(2) = point(1);
+			point(3) = point(1);
+		}
+		else if ( (Type == SplineType::NaturalCubic) || (axisPointNumber < 4) )	// continue the coefficients linearly beyond the limits of the axis, which is consistent with the vanishing second derivatives of the natural spline
+		{
+			point(0) = 2.0 * point(1) - point(2);
+			point(axisPointNumber + 1) = 2.0 * point(axisPointNumber) - point(axisPointNumber - 1);
+			point(axisPointNumber + 2) = 2.0 * point(axisPointNumber + 1) - point(axisPointNumber);
+		}
+		else	// extrapolate the function values cubically beyond the limits of the axis, which retains the third order accuracy of the Catmull-Rom interpolation in the outermost cells
+		{
+			const std::size_t n = axisPointNumber;
+			
+			point(0) = 4.0 * point(1) - 6.0 * point(2) + 4.0 * point(3) - point(4);
+			point(n + 1) = 4.0 * point(n) - 6.0 * point(n - 1) + 4.0 * point(n - 2) - point(n - 3);
+			point(n + 2) = 4.0 * point(n + 1) - 6.0 * point(n) + 4.0 * point(n - 1) - point(n - 2);
+		}
+	});
+}
+
+template <std::size_t Dim>
+void MultiDimGrid::SplineGridFunction<Dim>::compute_stencil_weights (const SplineType splineType, const double interpolationWeight, double* stencilWeights)
+{
+	const double t = interpolationWeight;
+	const double t2 = t * t;
+	const double t3 = t2 * t;
+	
+	if ( splineType == SplineType::NaturalCubic )	// uniform cubic B-spline basis
+	{
+		const double s = 1.0 - t;
+		
+		stencilWeights[0] = s * s * s / 6.0;
+		stencilWeights[1] = (3.0 * t3 - 6.0 * t2 + 4.0) / 6.0;
+		stencilWeights[2] = (-3.0 * t3 + 3.0 * t2 + 3.0 * t + 1.0) / 6.0;
+		stencilWeights[3] = t3 / 6.0;
+	}
+	else	// Catmull-Rom basis
+	{
+		stencilWeights[0] = (-t3 + 2.0 * t2 - t) / 2.0;
+		stencilWeights[1] = (3.0 * t3 - 5.0 * t2 + 2.0) / 2.0;
+		stencilWeights[2] = (-3.0 * t3 + 4.0 * t2 + t) / 2.0;
+		stencilWeights[3] = (t3 - t2) / 2.0;
+	}
+}
\ No newline at end of file
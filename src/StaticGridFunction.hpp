@@ -0,0 +1,228 @@
+#ifndef MULTIDIMGRID_STATIC_GRID_FUNCTION_H
+#define MULTIDIMGRID_STATIC_GRID_FUNCTION_H
+
+#include "CoordinateAxis.hpp"
+#include "GridFunction.hpp"
+#include "Parallelization.hpp"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace MultiDimGrid
+{
+	/**
+	 * Compile-time sequence of the indices \a Indices, which allows to expand a parameter pack together with the position
+	 * of each of its elements.
+	 */
+	template <std::size_t... Indices>
+	struct IndexSequence
+	{};
+	
+	/**
+	 * Provides the type MakeIndexSequence::Type, which is the MultiDimGrid::IndexSequence of the indices 0, ... , \a Length-1.
+	 */
+	template <std::size_t Length, std::size_t... Indices>
+	struct MakeIndexSequence : MakeIndexSequence<Length - 1, Length - 1, Indices...>
+	{};
+	
+	/**
+	 * Terminates the recursion of MultiDimGrid::MakeIndexSequence.
+	 */
+	template <std::size_t... Indices>
+	struct MakeIndexSequence<0, Indices...>
+	{
+		typedef IndexSequence<Indices...> Type;
+	};
+	
+	/**
+	 * \brief Class providing a discrete function defined on a multi-dimensional coordinate grid whose coordinate axis
+	 * types are known at compile time.
+	 * 
+	 * The grid is spanned up by one coordinate axis of each of the types \a Axes, which have to be classes derived from
+	 * CoordinateAxis. In contrast to GridFunction, which accesses its coordinate axes through CoordinateAxis pointers,
+	 * this class knows the types of the axes and locates coordinates on them without virtual dispatch. This allows the
+	 * compiler to inline the axis lookups into the interpolation, which makes it considerably faster, especially for
+	 * low-dimensional grids. Gathering the function values at the corners of the grid cell and interpolating between
+	 * them is left to the GridFunction.
+	 * 
+	 * The coordinate axes and the function values are held in a GridFunction, whose axis types are checked once at
+	 * construction. It is accessible through StaticGridFunction::grid_function for all functionality that is not
+	 * performance-critical, so that a StaticGridFunction can be used wherever a GridFunction is expected. Conversely,
+	 * a StaticGridFunction can be created from any GridFunction with matching axis types.
+	 */
+	template <class... Axes>
+	class StaticGridFunction
+	{
+	public:
+		/**
+		 * Number of dimensions of the grid.
+		 */
+		static constexpr std::size_t Dim = sizeof...(Axes);
+		
+		/**
+		 * Constructor instantiating a discrete function defined on a grid spanned up by the coordinate axes \a coordAxes
+		 * with constant function value \a funcValue.
+		 */
+		StaticGridFunction (const std::tuple<Axes...>& coordAxes, double funcValue);
+		
+		/**
+		 * Constructor instantiating a discrete function defined on a grid spanned up by the coordinate axes \a coordAxes
+		 * with the function value of each grid point set to the value of the MultiDimGrid::Function \a func at the coordinates
+		 * of this grid point.
+		 * 
+		 * The evaluations of \a func are distributed among OpenMP threads according to \a schedule, so \a func has
+		 * to be safe to call concurrently unless \a schedule is ParallelSchedule::Serial.
+		 */
+		StaticGridFunction (const std::tuple<Axes...>& coordAxes, const Function<Dim>& func, ParallelSchedule schedule = ParallelSchedule::Serial);
+		
+		/**
+		 * Constructor instantiating a copy of the GridFunction \a gridFunc. The coordinate axes of \a gridFunc have to
+		 * be exactly of the types \a Axes, not of types derived from them.
+		 */
+		explicit StaticGridFunction (const GridFunction<Dim>& gridFunc);
+		
+		/**
+		 * Gives access to the function value at the grid point \a gridPoint by returning a \c reference to it.
+		 * 
+		 * This provides the same functionality as GridFunction::value(const GridPoint<Dim>& gridPoint).
+		 */
+		double& value (const GridPoint<Dim>& gridPoint);
+		
+		/**
+		 * Gives access to the function value at the grid point \a gridPoint by returning a \c const_reference to it.
+		 * 
+		 * This provides the same functionality as GridFunction::value(const GridPoint<Dim>& gridPoint) const.
+		 */
+		const double& value (const GridPoint<Dim>& gridPoint) const;
+		
+		/**
+		 * Gives access to the function value at the grid point with index \a index by returning a \c reference to it.
+		 * 
+		 * This provides the same functionality as GridFunction::value_at_index(std::size_t index).
+		 */
+		double& value_at_index (std::size_t index);
+		
+		/**
+		 * Gives access to the function value at the grid point with index \a index by returning a \c const_reference to
+		 * it.
+		 * 
+		 * This provides the same functionality as GridFunction::value_at_index(std::size_t index) const.
+		 */
+		const double& value_at_index (std::size_t index) const;
+		
+		/**
+		 * Returns the interpolated function value of the discrete function at the coordinates \a coords.
+		 */
+		double interpolate (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Returns the interpolated function value of the discrete function at the coordinates \a coords.
+		 * 
+		 * In contrast to StaticGridFunction::interpolate, this method does not check if \a coords is within the range of
+		 * the grid. It is thus slightly faster, but unsafe!
+		 */
+		double interpolate_unchecked (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Overloads the paranthesis operator to return the interpolated function value of the discrete function at the
+		 * coordinates \a coords.
+		 * 
+		 * This provides the same functionality as StaticGridFunction::interpolate.
+		 */
+		double operator() (const Coordinates<Dim>& coords) const;
+		
+		/**
+		 * Computes the interpolated function values of the discrete function at the \a number coordinates stored in the
+		 * array \a coords and writes them to the array \a values, which has to be of the same length. The coordinates
+		 * are distributed among OpenMP threads according to \a schedule.
+		 */
+		void interpolate_many (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Computes the interpolated function values of the discrete function at the \a number coordinates stored in the
+		 * array \a coords and writes them to the array \a values, which has to be of the same length. The coordinates
+		 * are distributed among OpenMP threads according to \a schedule.
+		 * 
+		 * In contrast to StaticGridFunction::interpolate_many, this method does not check if \a coords are within the
+		 * range of the grid. It is thus slightly faster, but unsafe!
+		 */
+		void interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, std::size_t number, ParallelSchedule schedule = ParallelSchedule::Serial) const;
+		
+		/**
+		 * Returns a reference to the coordinate axis with index \a i_axis.
+		 */
+		template <std::size_t i_axis>
+		const typename std::tuple_element<i_axis, std::tuple<Axes...>>::type& coordinate_axis () const;
+		
+		/**
+		 * Returns a reference to the GridFunction holding the function values, which provides all the functionality
+		 * of GridFunction that is not reimplemented by this class.
+		 */
+		const GridFunction<Dim>& grid_function () const;
+	
+	private:
+		/**
+		 * Number of grid points surrounding the coordinates in an interpolation, i.e. the number of corners of a grid cell.
+		 */
+		static constexpr std::size_t CornerNumber = std::size_t(1) << Dim;
+		
+		/**
+		 * GridFunction holding the coordinate axes and the function values.
+		 */
+		GridFunction<Dim> GridFunc;
+		
+		/**
+		 * Returns MultiDimGrid::CoordinateAxisPointers to the coordinate axes in \a coordAxes. \a AxisIndices have to
+		 * enumerate all axes.
+		 */
+		template <std::size_t... AxisIndices>
+		static CoordinateAxisPointers<Dim> coordinate_axis_pointers (const std::tuple<Axes...>& coordAxes, IndexSequence<AxisIndices...>);
+		
+		/**
+		 * Checks if the coordinate axes of StaticGridFunction::GridFunc with indices larger than or equal to \a i_axis
+		 * are exactly of the types \a Axes by recursing over the axes at compile time. If that is not the case, an error message
+		 * is written to the standard output and the program is terminated.
+		 */
+		template <std::size_t i_axis>
+		void check_coordinate_axis_types (std::integral_constant<std::size_t, i_axis>) const;
+		
+		/**
+		 * Terminates the recursion of StaticGridFunction::check_coordinate_axis_types.
+		 */
+		void check_coordinate_axis_types (std::integral_constant<std::size_t, Dim>) const;
+		
+		/**
+		 * Determines the grid cell containing the coordinates \a coords along all axes with indices larger than or equal
+		 * to \a i_axis by recursing over the axes at compile time. The lower axis points of the cell are written to
+		 * \a cellAxisPoints and the interpolation weights to \a interpolationWeights.
+		 * 
+		 * If \a checkCoordinates is \c true, it is checked whether \a coords are within the range of the grid.
+		 */
+		template <std::size_t i_axis>
+		void locate_cell (const Coordinates<Dim>& coords, GridPoint<Dim>& cellAxisPoints, DoubleArray<Dim>& interpolationWeights, bool checkCoordinates, std::integral_constant<std::size_t, i_axis>) const;
+		
+		/**
+		 * Terminates the recursion of StaticGridFunction::locate_cell.
+		 */
+		void locate_cell (const Coordinates<Dim>& coords, GridPoint<Dim>& cellAxisPoints, DoubleArray<Dim>& interpolationWeights, bool checkCoordinates, std::integral_constant<std::size_t, Dim>) const;
+		
+		/**
+		 * Implements StaticGridFunction::interpolate and StaticGridFunction::interpolate_unchecked, depending on
+		 * \a checkCoordinates.
+		 */
+		double internal_interpolation (const Coordinates<Dim>& coords, bool checkCoordinates) const;
+		
+		/**
+		 * Checks if the coordinate \a coord of the coordinate axis \a axis is out of range. If that is the case, an error
+		 * message is written to the standard output and the program is terminated. The error message contains \a location,
+		 * which specifies in which member the coordinate range is checked.
+		 */
+		static void check_coordinate (double coord, const CoordinateAxis& axis, const char* location);
+	};
+}
+
+#include "StaticGridFunction.tpp"	// template implementations can not be compiled separately
+
+#endif
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+
+template <class... Axes>
+constexpr std::size_t MultiDimGrid::StaticGridFunction<Axes...>::Dim;
+
+template <class... Axes>
+constexpr std::size_t MultiDimGrid::StaticGridFunction<Axes...>::CornerNumber;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public
+
+template <class... Axes>
+MultiDimGrid::StaticGridFunction<Axes...>::StaticGridFunction (const std::tuple<Axes...>& coordAxes, const double funcValue) :
+	GridFunc(coordinate_axis_pointers(coordAxes, typename MakeIndexSequence<Dim>::Type()), funcValue)
+{
+	static_assert(Dim != 0, "MultiDimGrid::StaticGridFunction Error: Number of dimensions is zero");
+	
+	check_coordinate_axis_types(std::integral_constant<std::size_t, 0>());
+}
+
+template <class... Axes>
+MultiDimGrid::StaticGridFunction<Axes...>::StaticGridFunction (const std::tuple<Axes...>& coordAxes, const Function<Dim>& func, const ParallelSchedule schedule) :
+	GridFunc(coordinate_axis_pointers(coordAxes, typename MakeIndexSequence<Dim>::Type()), func, schedule)
+{
+	static_assert(Dim != 0, "MultiDimGrid::StaticGridFunction Error: Number of dimensions is zero");
+	
+	check_coordinate_axis_types(std::integral_constant<std::size_t, 0>());
+}
+
+template <class... Axes>
+MultiDimGrid::StaticGridFunction<Axes...>::StaticGridFunction (const GridFunction<Dim>& gridFunc) :
+	GridFunc(gridFunc)
+{
+	static_assert(Dim != 0, "MultiDimGrid::StaticGridFunction Error: Number of dimensions is zero");
+	
+	check_coordinate_axis_types(std::integral_constant<std::size_t, 0>());
+}
+
+template <class... Axes>
+double& MultiDimGrid::StaticGridFunction<Axes...>::value (const GridPoint<Dim>& gridPoint)
+{
+	return GridFunc.value(gridPoint);
+}
+
+template <class... Axes>
+const double& MultiDimGrid::StaticGridFunction<Axes...>::value (const GridPoint<Dim>& gridPoint) const
+{
+	return GridFunc.value(gridPoint);
+}
+
+template <class... Axes>
+double& MultiDimGrid::StaticGridFunction<Axes...>::value_at_index (const std::size_t index)
+{
+	return GridFunc.value_at_index(index);
+}
+
+template <class... Axes>
+const double& MultiDimGrid::StaticGridFunction<Axes...>::value_at_index (const std::size_t index) const
+{
+	return GridFunc.value_at_index(index);
+}
+
+template <class... Axes>
+double MultiDimGrid::StaticGridFunction<Axes...>::interpolate (const Coordinates<Dim>& coords) const
+{
+	return internal_interpolation(coords, true);
+}
+
+template <class... Axes>
+double MultiDimGrid::StaticGridFunction<Axes...>::interpolate_unchecked (const Coordinates<Dim>& coords) const
+{
+	return internal_interpolation(coords, false);
+}
+
+template <class... Axes>
+double MultiDimGrid::StaticGridFunction<Axes...>::operator() (const Coordinates<Dim>& coords) const
+{
+	return interpolate(coords);
+}
+
+template <class... Axes>
+void MultiDimGrid::StaticGridFunction<Axes...>::interpolate_many (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, values] (const std::size_t i_coords)
+	{
+		values[i_coords] = internal_interpolation(coords[i_coords], true);
+	});
+}
+
+template <class... Axes>
+void MultiDimGrid::StaticGridFunction<Axes...>::interpolate_many_unchecked (const Coordinates<Dim>* coords, double* values, const std::size_t number, const ParallelSchedule schedule) const
+{
+	parallel_for(number, schedule, [this, coords, values] (const std::size_t i_coords)
+	{
+		values[i_coords] = internal_interpolation(coords[i_coords], false);
+	});
+}
+
+template <class... Axes>
+template <std::size_t i_axis>
+const typename std::tuple_element<i_axis, std::tuple<Axes...>>::type& MultiDimGrid::StaticGridFunction<Axes...>::coordinate_axis () const
+{
+	typedef typename std::tuple_element<i_axis, std::tuple<Axes...>>::type Axis;
+	
+	return *static_cast<const Axis*>( GridFunc.CoordAxes[i_axis].get() );	// the type of the axis has been checked at construction
+}
+
+template <class... Axes>
+const MultiDimGrid::GridFunction<MultiDimGrid::StaticGridFunction<Axes...>::Dim>& MultiDimGrid::StaticGridFunction<Axes...>::grid_function () const
+{
+	return GridFunc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// protected
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private
+
+template <class... Axes>
+template <std::size_t... AxisIndices>
+MultiDimGrid::CoordinateAxisPointers<MultiDimGrid::StaticGridFunction<Axes...>::Dim> MultiDimGrid::StaticGridFunction<Axes...>::coordinate_axis_pointers (const std::tuple<Axes...>& coordAxes, IndexSequence<AxisIndices...>)
+{
+	return {{ &std::get<AxisIndices>(coordAxes)... }};
+}
+
+template <class... Axes>
+template <std::size_t i_axis>
+void MultiDimGrid::StaticGridFunction<Axes...>::check_coordinate_axis_types (std::integral_constant<std::size_t, i_axis>) const
+{
+	typedef typename std::tuple_element<i_axis, std::tuple<Axes...>>::type Axis;
+	
+	if ( typeid(*GridFunc.CoordAxes[i_axis]) != typeid(Axis) )	// a derived type is rejected as well, since it might override the methods which are called without virtual dispatch
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::StaticGridFunction Error: Type of coordinate axis " << i_axis << " of the GridFunction does not match" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+	
+	check_coordinate_axis_types(std::integral_constant<std::size_t, i_axis + 1>());	// continue with the next axis
+}
+
+template <class... Axes>
+void MultiDimGrid::StaticGridFunction<Axes...>::check_coordinate_axis_types (std::integral_constant<std::size_t, Dim>) const
+{}
+
+template <class... Axes>
+template <std::size_t i_axis>
+void MultiDimGrid::StaticGridFunction<Axes...>::locate_cell (const Coordinates<Dim>& coords, GridPoint<Dim>& cellAxisPoints, DoubleArray<Dim>& interpolationWeights, const bool checkCoordinates, std::integral_constant<std::size_t, i_axis>) const
+{
+	typedef typename std::tuple_element<i_axis, std::tuple<Axes...>>::type Axis;
+	
+	const Axis& axis = coordinate_axis<i_axis>();
+	
+	const double coord = coords[i_axis];
+	
+	if ( checkCoordinates )
+	{
+		check_coordinate(coord, axis, "interpolate");
+	}
+	
+	const AxisLocation location = axis.Axis::locate_unchecked(coord);	// the qualified call bypasses the virtual dispatch, so that the lookup can be inlined
+	
+	cellAxisPoints[i_axis] = GridFunction<Dim>::cell_axis_point(location, axis.point_number(), interpolationWeights[i_axis]);
+	
+	locate_cell(coords, cellAxisPoints, interpolationWeights, checkCoordinates, std::integral_constant<std::size_t, i_axis + 1>());	// continue with the next axis
+}
+
+template <class... Axes>
+void MultiDimGrid::StaticGridFunction<Axes...>::locate_cell (const Coordinates<Dim>& coords, GridPoint<Dim>& cellAxisPoints, DoubleArray<Dim>& interpolationWeights, const bool checkCoordinates, std::integral_constant<std::size_t, Dim>) const
+{}
+
+template <class... Axes>
+double MultiDimGrid::StaticGridFunction<Axes...>::internal_interpolation (const Coordinates<Dim>& coords, const bool checkCoordinates) const
+{
+	GridPoint<Dim> cellAxisPoints;
+	DoubleArray<Dim> interpolationWeights;
+	
+	locate_cell(coords, cellAxisPoints, interpolationWeights, checkCoordinates, std::integral_constant<std::size_t, 0>());
+	
+	std::array<double, CornerNumber> cornerValues;
+	
+	GridFunc.gather_cell_corner_values(cellAxisPoints, cornerValues.data());
+	
+	return GridFunc.interpolate_corner_values(cornerValues.data(), interpolationWeights);
+}
+
+template <class... Axes>
+void MultiDimGrid::StaticGridFunction<Axes...>::check_coordinate (const double coord, const CoordinateAxis& axis, const char* location)
+{
+	if ( (coord < axis.lower_coordinate_limit()) || (coord > axis.upper_coordinate_limit()) )
+	{
+		std::cout << std::endl
+				  << " MultiDimGrid::StaticGridFunction::" + std::string(location) + " Coordinates not within range of grid" << std::endl
+				  << std::endl;
+		
+		exit(EXIT_FAILURE);
+	}
+}
\ No newline at end of file